@@ -1,11 +1,35 @@
 #pragma once
 
 #include "Pargon/Containers/Array.h"
+#include "Pargon/Containers/ArrayMath.h"
+#include "Pargon/Containers/BitList.h"
 #include "Pargon/Containers/Blueprint.h"
 #include "Pargon/Containers/Buffer.h"
+#include "Pargon/Containers/ConcurrentQueue.h"
+#include "Pargon/Containers/Deque.h"
 #include "Pargon/Containers/Function.h"
+#include "Pargon/Containers/GridView.h"
+#include "Pargon/Containers/Grouping.h"
+#include "Pargon/Containers/Hash.h"
 #include "Pargon/Containers/List.h"
 #include "Pargon/Containers/Map.h"
+#include "Pargon/Containers/PackedList.h"
+#include "Pargon/Containers/Parallel.h"
+#include "Pargon/Containers/PersistentList.h"
+#include "Pargon/Containers/PersistentMap.h"
+#include "Pargon/Containers/Pipeline.h"
+#include "Pargon/Containers/Pool.h"
+#include "Pargon/Containers/PriorityQueue.h"
+#include "Pargon/Containers/Search.h"
+#include "Pargon/Containers/SearchTree.h"
 #include "Pargon/Containers/Sequence.h"
+#include "Pargon/Containers/SlotMap.h"
+#include "Pargon/Containers/Snapshot.h"
+#include "Pargon/Containers/SoaList.h"
+#include "Pargon/Containers/Sort.h"
+#include "Pargon/Containers/SortNetwork.h"
+#include "Pargon/Containers/SparseSet.h"
+#include "Pargon/Containers/StableList.h"
+#include "Pargon/Containers/StridedView.h"
 #include "Pargon/Containers/String.h"
 #include "Pargon/Containers/Text.h"
@@ -8,7 +8,7 @@
 
 namespace Pargon
 {
-	template<typename ItemType, int N>
+	template<typename ItemType, int N, int Alignment>
 	class Array
 	{
 	public:
@@ -18,25 +18,25 @@ namespace Pargon
 		constexpr Array();
 		constexpr Array(const std::array<ItemType, N>& array);
 
-		auto operator=(ItemType const (&array)[N]) -> Array<ItemType, N>&;
+		auto operator=(ItemType const (&array)[N]) -> Array<ItemType, N, Alignment>&;
 
-		auto begin() -> Iterator;
-		auto begin() const -> ConstIterator;
-		auto end() -> Iterator;
-		auto end() const -> ConstIterator;
+		constexpr auto begin() -> Iterator;
+		constexpr auto begin() const -> ConstIterator;
+		constexpr auto end() -> Iterator;
+		constexpr auto end() const -> ConstIterator;
 
 		constexpr auto IsEmpty() const -> bool;
 		constexpr auto Count() const -> int;
 		constexpr auto LastIndex() const -> int;
 
-		auto First() -> ItemType&;
-		auto First() const -> const ItemType&;
-		auto Last() -> ItemType&;
-		auto Last() const -> const ItemType&;
-		auto Item(int index) -> ItemType&;
-		auto Item(int index) const -> const ItemType&;
-		void SetItem(int index, ItemType&& item);
-		void SetItem(int index, const ItemType& item);
+		constexpr auto First() -> ItemType&;
+		constexpr auto First() const -> const ItemType&;
+		constexpr auto Last() -> ItemType&;
+		constexpr auto Last() const -> const ItemType&;
+		constexpr auto Item(int index) -> ItemType&;
+		constexpr auto Item(int index) const -> const ItemType&;
+		constexpr void SetItem(int index, ItemType&& item);
+		constexpr void SetItem(int index, const ItemType& item);
 
 		auto GetView() const -> SequenceView<ItemType>;
 		auto GetView(int index) const -> SequenceView<ItemType>;
@@ -46,162 +46,162 @@ namespace Pargon
 		auto GetReference(int index, int count) -> SequenceReference<ItemType>;
 
 	private:
-		std::array<ItemType, N> _array;
+		alignas(Alignment) std::array<ItemType, N> _array;
 	};
 }
 
-template<typename ItemType, int N> constexpr
-Pargon::Array<ItemType, N>::Array() :
+template<typename ItemType, int N, int Alignment> constexpr
+Pargon::Array<ItemType, N, Alignment>::Array() :
 	_array()
 {
 }
 
-template<typename ItemType, int N> constexpr
-Pargon::Array<ItemType, N>::Array(const std::array<ItemType, N>& array) :
+template<typename ItemType, int N, int Alignment> constexpr
+Pargon::Array<ItemType, N, Alignment>::Array(const std::array<ItemType, N>& array) :
 	_array(array)
 {
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::operator=(ItemType const (&array)[N]) -> Array<ItemType, N>&
+template<typename ItemType, int N, int Alignment>
+auto Pargon::Array<ItemType, N, Alignment>::operator=(ItemType const (&array)[N]) -> Array<ItemType, N, Alignment>&
 {
 	std::copy(array, array + N, _array.begin());
 	return *this;
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::begin() -> Iterator
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::begin() -> Iterator
 {
 	return _array.data();
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::begin() const -> ConstIterator
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::begin() const -> ConstIterator
 {
 	return _array.data();
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::end() -> Iterator
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::end() -> Iterator
 {
 	return _array.data() + N;
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::end() const -> ConstIterator
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::end() const -> ConstIterator
 {
 	return _array.data() + N;
 }
 
-template<typename ItemType, int N> constexpr
-auto Pargon::Array<ItemType, N>::IsEmpty() const -> bool
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::IsEmpty() const -> bool
 {
 	return N == 0;
 }
 
-template<typename ItemType, int N> constexpr
-auto Pargon::Array<ItemType, N>::Count() const -> int
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::Count() const -> int
 {
 	return N;
 }
 
-template<typename ItemType, int N> constexpr
-auto Pargon::Array<ItemType, N>::LastIndex() const -> int
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::LastIndex() const -> int
 {
 	return N - 1;
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::First() -> ItemType&
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::First() -> ItemType&
 {
 	assert(N != 0);
 	return _array[0];
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::First() const -> const ItemType&
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::First() const -> const ItemType&
 {
 	assert(N != 0);
 	return _array[0];
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::Last() -> ItemType&
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::Last() -> ItemType&
 {
 	assert(N != 0);
 	return _array[N - 1];
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::Last() const -> const ItemType&
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::Last() const -> const ItemType&
 {
 	assert(N != 0);
 	return _array[N - 1];
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::Item(int index) -> ItemType&
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::Item(int index) -> ItemType&
 {
 	assert(index < N);
 	return _array[index];
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::Item(int index) const -> const ItemType&
+template<typename ItemType, int N, int Alignment> constexpr
+auto Pargon::Array<ItemType, N, Alignment>::Item(int index) const -> const ItemType&
 {
 	assert(index < N);
 	return _array[index];
 }
 
-template<typename ItemType, int N>
-void Pargon::Array<ItemType, N>::SetItem(int index, ItemType&& value)
+template<typename ItemType, int N, int Alignment> constexpr
+void Pargon::Array<ItemType, N, Alignment>::SetItem(int index, ItemType&& value)
 {
 	assert(index < N);
 	_array[index] = std::move(value);
 }
 
-template<typename ItemType, int N>
-void Pargon::Array<ItemType, N>::SetItem(int index, const ItemType& value)
+template<typename ItemType, int N, int Alignment> constexpr
+void Pargon::Array<ItemType, N, Alignment>::SetItem(int index, const ItemType& value)
 {
 	assert(index < N);
 	_array[index] = value;
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::GetView() const -> SequenceView<ItemType>
+template<typename ItemType, int N, int Alignment>
+auto Pargon::Array<ItemType, N, Alignment>::GetView() const -> SequenceView<ItemType>
 {
 	return GetView(0, N);
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::GetView(int start) const -> SequenceView<ItemType>
+template<typename ItemType, int N, int Alignment>
+auto Pargon::Array<ItemType, N, Alignment>::GetView(int start) const -> SequenceView<ItemType>
 {
 	return GetView(start, N - start);
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::GetView(int start, int count) const -> SequenceView<ItemType>
+template<typename ItemType, int N, int Alignment>
+auto Pargon::Array<ItemType, N, Alignment>::GetView(int start, int count) const -> SequenceView<ItemType>
 {
 	if (start < 0 || (start + count > N))
 		return {};
 
-	return { _array.data() + start, count };
+	return SequenceView<ItemType>(_array.data() + start, count);
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::GetReference() -> SequenceReference<ItemType>
+template<typename ItemType, int N, int Alignment>
+auto Pargon::Array<ItemType, N, Alignment>::GetReference() -> SequenceReference<ItemType>
 {
 	return GetReference(0, N);
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::GetReference(int start) -> SequenceReference<ItemType>
+template<typename ItemType, int N, int Alignment>
+auto Pargon::Array<ItemType, N, Alignment>::GetReference(int start) -> SequenceReference<ItemType>
 {
 	return GetReference(start, N - start);
 }
 
-template<typename ItemType, int N>
-auto Pargon::Array<ItemType, N>::GetReference(int start, int count) -> SequenceReference<ItemType>
+template<typename ItemType, int N, int Alignment>
+auto Pargon::Array<ItemType, N, Alignment>::GetReference(int start, int count) -> SequenceReference<ItemType>
 {
 	if (start < 0 || (start + count > N))
 		return {};
@@ -210,16 +210,16 @@ auto Pargon::Array<ItemType, N>::GetReference(int start, int count) -> SequenceR
 }
 
 template<typename ItemType>
-template<int N>
-Pargon::SequenceView<ItemType>::SequenceView(const Array<ItemType, N>& array) :
+template<int N, int Alignment>
+Pargon::SequenceView<ItemType>::SequenceView(const Array<ItemType, N, Alignment>& array) :
 	_data(array.begin()),
 	_count(N)
 {
 }
 
 template<typename ItemType>
-template<int N>
-Pargon::SequenceReference<ItemType>::SequenceReference(Array<ItemType, N>& array) :
+template<int N, int Alignment>
+Pargon::SequenceReference<ItemType>::SequenceReference(Array<ItemType, N, Alignment>& array) :
 	_data(array.begin()),
 	_count(N)
 {
@@ -0,0 +1,326 @@
+#pragma once
+
+#include "Pargon/Containers/Array.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#include <immintrin.h>
+	#define PARGON_ARRAY_SSE
+#endif
+
+#if defined(PARGON_ARRAY_SSE) && (defined(__SSE4_1__) || defined(__AVX__))
+	#define PARGON_ARRAY_SSE41
+#endif
+
+namespace Pargon
+{
+	class ArrayMath
+	{
+	public:
+		template<typename ItemType, int N, int Alignment> static auto Add(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>;
+		template<typename ItemType, int N, int Alignment> static auto Subtract(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>;
+		template<typename ItemType, int N, int Alignment> static auto Multiply(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>;
+		template<typename ItemType, int N, int Alignment> static auto MultiplyAdd(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right, const Array<ItemType, N, Alignment>& addend) -> Array<ItemType, N, Alignment>;
+		template<typename ItemType, int N, int Alignment> static auto Minimum(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>;
+		template<typename ItemType, int N, int Alignment> static auto Maximum(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>;
+
+		template<typename ItemType, int N, int Alignment> static auto Dot(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> ItemType;
+		template<typename ItemType, int N, int Alignment> static auto Sum(const Array<ItemType, N, Alignment>& array) -> ItemType;
+		template<typename ItemType, int N, int Alignment> static auto Smallest(const Array<ItemType, N, Alignment>& array) -> ItemType;
+		template<typename ItemType, int N, int Alignment> static auto Largest(const Array<ItemType, N, Alignment>& array) -> ItemType;
+
+	private:
+		enum class Operation { Add, Subtract, Multiply, Minimum, Maximum };
+
+		template<typename ItemType> struct Lanes { static constexpr int Width = 1; };
+
+		template<Operation Operator, typename ItemType> static auto Apply(ItemType left, ItemType right) -> ItemType;
+		template<Operation Operator, typename ItemType, int N, int Alignment> static auto Combine(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>;
+		template<Operation Operator, typename ItemType, int N, int Alignment> static auto Reduce(const Array<ItemType, N, Alignment>& array) -> ItemType;
+	};
+}
+
+#if defined(PARGON_ARRAY_SSE)
+template<>
+struct Pargon::ArrayMath::Lanes<float>
+{
+#if defined(__AVX__)
+	using Type = __m256;
+	static constexpr int Width = 8;
+
+	template<bool Aligned> static auto Load(const float* items) -> Type { if constexpr (Aligned) return _mm256_load_ps(items); else return _mm256_loadu_ps(items); }
+	template<bool Aligned> static void Store(float* items, Type value) { if constexpr (Aligned) _mm256_store_ps(items, value); else _mm256_storeu_ps(items, value); }
+	static auto Zero() -> Type { return _mm256_setzero_ps(); }
+	static auto Add(Type left, Type right) -> Type { return _mm256_add_ps(left, right); }
+	static auto Subtract(Type left, Type right) -> Type { return _mm256_sub_ps(left, right); }
+	static auto Multiply(Type left, Type right) -> Type { return _mm256_mul_ps(left, right); }
+	static auto Minimum(Type left, Type right) -> Type { return _mm256_min_ps(left, right); }
+	static auto Maximum(Type left, Type right) -> Type { return _mm256_max_ps(left, right); }
+#if defined(__FMA__)
+	static auto MultiplyAdd(Type left, Type right, Type addend) -> Type { return _mm256_fmadd_ps(left, right, addend); }
+#else
+	static auto MultiplyAdd(Type left, Type right, Type addend) -> Type { return _mm256_add_ps(_mm256_mul_ps(left, right), addend); }
+#endif
+#else
+	using Type = __m128;
+	static constexpr int Width = 4;
+
+	template<bool Aligned> static auto Load(const float* items) -> Type { if constexpr (Aligned) return _mm_load_ps(items); else return _mm_loadu_ps(items); }
+	template<bool Aligned> static void Store(float* items, Type value) { if constexpr (Aligned) _mm_store_ps(items, value); else _mm_storeu_ps(items, value); }
+	static auto Zero() -> Type { return _mm_setzero_ps(); }
+	static auto Add(Type left, Type right) -> Type { return _mm_add_ps(left, right); }
+	static auto Subtract(Type left, Type right) -> Type { return _mm_sub_ps(left, right); }
+	static auto Multiply(Type left, Type right) -> Type { return _mm_mul_ps(left, right); }
+	static auto Minimum(Type left, Type right) -> Type { return _mm_min_ps(left, right); }
+	static auto Maximum(Type left, Type right) -> Type { return _mm_max_ps(left, right); }
+#if defined(__FMA__)
+	static auto MultiplyAdd(Type left, Type right, Type addend) -> Type { return _mm_fmadd_ps(left, right, addend); }
+#else
+	static auto MultiplyAdd(Type left, Type right, Type addend) -> Type { return _mm_add_ps(_mm_mul_ps(left, right), addend); }
+#endif
+#endif
+};
+#endif
+
+#if defined(PARGON_ARRAY_SSE41)
+template<>
+struct Pargon::ArrayMath::Lanes<int>
+{
+#if defined(__AVX2__)
+	using Type = __m256i;
+	static constexpr int Width = 8;
+
+	template<bool Aligned> static auto Load(const int* items) -> Type { if constexpr (Aligned) return _mm256_load_si256(reinterpret_cast<const Type*>(items)); else return _mm256_loadu_si256(reinterpret_cast<const Type*>(items)); }
+	template<bool Aligned> static void Store(int* items, Type value) { if constexpr (Aligned) _mm256_store_si256(reinterpret_cast<Type*>(items), value); else _mm256_storeu_si256(reinterpret_cast<Type*>(items), value); }
+	static auto Zero() -> Type { return _mm256_setzero_si256(); }
+	static auto Add(Type left, Type right) -> Type { return _mm256_add_epi32(left, right); }
+	static auto Subtract(Type left, Type right) -> Type { return _mm256_sub_epi32(left, right); }
+	static auto Multiply(Type left, Type right) -> Type { return _mm256_mullo_epi32(left, right); }
+	static auto Minimum(Type left, Type right) -> Type { return _mm256_min_epi32(left, right); }
+	static auto Maximum(Type left, Type right) -> Type { return _mm256_max_epi32(left, right); }
+#else
+	using Type = __m128i;
+	static constexpr int Width = 4;
+
+	template<bool Aligned> static auto Load(const int* items) -> Type { if constexpr (Aligned) return _mm_load_si128(reinterpret_cast<const Type*>(items)); else return _mm_loadu_si128(reinterpret_cast<const Type*>(items)); }
+	template<bool Aligned> static void Store(int* items, Type value) { if constexpr (Aligned) _mm_store_si128(reinterpret_cast<Type*>(items), value); else _mm_storeu_si128(reinterpret_cast<Type*>(items), value); }
+	static auto Zero() -> Type { return _mm_setzero_si128(); }
+	static auto Add(Type left, Type right) -> Type { return _mm_add_epi32(left, right); }
+	static auto Subtract(Type left, Type right) -> Type { return _mm_sub_epi32(left, right); }
+	static auto Multiply(Type left, Type right) -> Type { return _mm_mullo_epi32(left, right); }
+	static auto Minimum(Type left, Type right) -> Type { return _mm_min_epi32(left, right); }
+	static auto Maximum(Type left, Type right) -> Type { return _mm_max_epi32(left, right); }
+#endif
+	static auto MultiplyAdd(Type left, Type right, Type addend) -> Type { return Add(Multiply(left, right), addend); }
+};
+#endif
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Add(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>
+{
+	return Combine<Operation::Add>(left, right);
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Subtract(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>
+{
+	return Combine<Operation::Subtract>(left, right);
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Multiply(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>
+{
+	return Combine<Operation::Multiply>(left, right);
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::MultiplyAdd(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right, const Array<ItemType, N, Alignment>& addend) -> Array<ItemType, N, Alignment>
+{
+	using LanesType = Lanes<ItemType>;
+
+	Array<ItemType, N, Alignment> result;
+	auto i = 0;
+
+	if constexpr (LanesType::Width > 1)
+	{
+		constexpr auto aligned = Alignment >= static_cast<int>(sizeof(typename LanesType::Type));
+
+		for (; i + LanesType::Width <= N; i += LanesType::Width)
+			LanesType::template Store<aligned>(result.begin() + i, LanesType::MultiplyAdd(LanesType::template Load<aligned>(left.begin() + i), LanesType::template Load<aligned>(right.begin() + i), LanesType::template Load<aligned>(addend.begin() + i)));
+	}
+
+	for (; i < N; i++)
+		result.begin()[i] = left.begin()[i] * right.begin()[i] + addend.begin()[i];
+
+	return result;
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Minimum(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>
+{
+	return Combine<Operation::Minimum>(left, right);
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Maximum(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>
+{
+	return Combine<Operation::Maximum>(left, right);
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Dot(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> ItemType
+{
+	using LanesType = Lanes<ItemType>;
+
+	ItemType result{};
+	auto i = 0;
+
+	if constexpr (LanesType::Width > 1 && N >= LanesType::Width)
+	{
+		constexpr auto aligned = Alignment >= static_cast<int>(sizeof(typename LanesType::Type));
+
+		auto sum = LanesType::Zero();
+
+		for (; i + LanesType::Width <= N; i += LanesType::Width)
+			sum = LanesType::MultiplyAdd(LanesType::template Load<aligned>(left.begin() + i), LanesType::template Load<aligned>(right.begin() + i), sum);
+
+		alignas(typename LanesType::Type) ItemType lanes[LanesType::Width];
+		LanesType::template Store<true>(lanes, sum);
+
+		for (auto lane = 0; lane < LanesType::Width; lane++)
+			result += lanes[lane];
+	}
+
+	for (; i < N; i++)
+		result += left.begin()[i] * right.begin()[i];
+
+	return result;
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Sum(const Array<ItemType, N, Alignment>& array) -> ItemType
+{
+	return Reduce<Operation::Add>(array);
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Smallest(const Array<ItemType, N, Alignment>& array) -> ItemType
+{
+	static_assert(N > 0, "Smallest requires a non-empty Array");
+	return Reduce<Operation::Minimum>(array);
+}
+
+template<typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Largest(const Array<ItemType, N, Alignment>& array) -> ItemType
+{
+	static_assert(N > 0, "Largest requires a non-empty Array");
+	return Reduce<Operation::Maximum>(array);
+}
+
+template<Pargon::ArrayMath::Operation Operator, typename ItemType>
+auto Pargon::ArrayMath::Apply(ItemType left, ItemType right) -> ItemType
+{
+	if constexpr (Operator == Operation::Add)
+		return left + right;
+	else if constexpr (Operator == Operation::Subtract)
+		return left - right;
+	else if constexpr (Operator == Operation::Multiply)
+		return left * right;
+	else if constexpr (Operator == Operation::Minimum)
+		return right < left ? right : left;
+	else if constexpr (Operator == Operation::Maximum)
+		return left < right ? right : left;
+}
+
+template<Pargon::ArrayMath::Operation Operator, typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Combine(const Array<ItemType, N, Alignment>& left, const Array<ItemType, N, Alignment>& right) -> Array<ItemType, N, Alignment>
+{
+	using LanesType = Lanes<ItemType>;
+
+	Array<ItemType, N, Alignment> result;
+	auto i = 0;
+
+	if constexpr (LanesType::Width > 1)
+	{
+		constexpr auto aligned = Alignment >= static_cast<int>(sizeof(typename LanesType::Type));
+
+		for (; i + LanesType::Width <= N; i += LanesType::Width)
+		{
+			auto leftLanes = LanesType::template Load<aligned>(left.begin() + i);
+			auto rightLanes = LanesType::template Load<aligned>(right.begin() + i);
+			typename LanesType::Type resultLanes;
+
+			if constexpr (Operator == Operation::Add)
+				resultLanes = LanesType::Add(leftLanes, rightLanes);
+			else if constexpr (Operator == Operation::Subtract)
+				resultLanes = LanesType::Subtract(leftLanes, rightLanes);
+			else if constexpr (Operator == Operation::Multiply)
+				resultLanes = LanesType::Multiply(leftLanes, rightLanes);
+			else if constexpr (Operator == Operation::Minimum)
+				resultLanes = LanesType::Minimum(leftLanes, rightLanes);
+			else if constexpr (Operator == Operation::Maximum)
+				resultLanes = LanesType::Maximum(leftLanes, rightLanes);
+
+			LanesType::template Store<aligned>(result.begin() + i, resultLanes);
+		}
+	}
+
+	for (; i < N; i++)
+		result.begin()[i] = Apply<Operator>(left.begin()[i], right.begin()[i]);
+
+	return result;
+}
+
+template<Pargon::ArrayMath::Operation Operator, typename ItemType, int N, int Alignment>
+auto Pargon::ArrayMath::Reduce(const Array<ItemType, N, Alignment>& array) -> ItemType
+{
+	using LanesType = Lanes<ItemType>;
+
+	if constexpr (N == 0)
+	{
+		return ItemType{};
+	}
+	else if constexpr (LanesType::Width > 1 && N >= LanesType::Width)
+	{
+		constexpr auto aligned = Alignment >= static_cast<int>(sizeof(typename LanesType::Type));
+
+		auto accumulated = LanesType::template Load<aligned>(array.begin());
+		auto i = LanesType::Width;
+
+		for (; i + LanesType::Width <= N; i += LanesType::Width)
+		{
+			auto lanes = LanesType::template Load<aligned>(array.begin() + i);
+
+			if constexpr (Operator == Operation::Add)
+				accumulated = LanesType::Add(accumulated, lanes);
+			else if constexpr (Operator == Operation::Minimum)
+				accumulated = LanesType::Minimum(accumulated, lanes);
+			else if constexpr (Operator == Operation::Maximum)
+				accumulated = LanesType::Maximum(accumulated, lanes);
+		}
+
+		alignas(typename LanesType::Type) ItemType lanes[LanesType::Width];
+		LanesType::template Store<true>(lanes, accumulated);
+
+		auto result = lanes[0];
+
+		for (auto lane = 1; lane < LanesType::Width; lane++)
+			result = Apply<Operator>(result, lanes[lane]);
+
+		for (; i < N; i++)
+			result = Apply<Operator>(result, array.begin()[i]);
+
+		return result;
+	}
+	else
+	{
+		auto result = array.begin()[0];
+
+		for (auto i = 1; i < N; i++)
+			result = Apply<Operator>(result, array.begin()[i]);
+
+		return result;
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Pargon/Containers/Function.h"
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <cstdint>
+
+namespace Pargon
+{
+	class BitList
+	{
+	public:
+		static constexpr int WordSize = 64;
+
+		BitList() = default;
+		BitList(int count, bool value);
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto LastIndex() const -> int;
+
+		auto Item(int index) const -> bool;
+		void SetItem(int index, bool value);
+		void FlipItem(int index);
+
+		auto Words() const -> SequenceView<uint64_t>;
+
+		void SetCount(int count);
+		void SetAll(bool value);
+		void Add(bool value);
+		void Clear();
+
+		void And(const BitList& other);
+		void Or(const BitList& other);
+		void Xor(const BitList& other);
+		void AndNot(const BitList& other);
+		void Invert();
+
+		auto CountOnes() const -> int;
+		auto Rank(int index) const -> int;
+		auto Select(int rank) const -> int;
+		auto FindNextSet(int start) const -> int;
+		void ForEachSet(FunctionView<void(int)> action) const;
+
+	private:
+		List<uint64_t> _words;
+		int _count = 0;
+
+		void ClearUnusedBits();
+	};
+}
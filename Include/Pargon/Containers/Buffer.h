@@ -44,9 +44,11 @@ namespace Pargon
 		void SetByte(int index, uint8_t value);
 		void SetBytes(int index, BufferView bytes);
 		void SetSize(int size);
+		void SetSizeUninitialized(int size);
 		void Append(uint8_t value, int count);
 		void Append(BufferView view, bool reverse);
 		auto Reserve(int size) -> BufferReference;
+		auto ReserveUninitialized(int size) -> BufferReference;
 		void Erase(uint8_t value);
 		void Clear();
 
@@ -62,6 +64,8 @@ namespace Pargon
 		int _available = 0;
 
 		std::unique_ptr<uint8_t[]> _data;
+
+		void Resize(int size, bool initialize);
 	};
 
 	class BufferView
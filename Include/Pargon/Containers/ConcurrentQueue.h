@@ -0,0 +1,367 @@
+#pragma once
+
+#include "Pargon/Containers/Sequence.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType>
+	class SpscQueue
+	{
+	public:
+		explicit SpscQueue(int capacity);
+		SpscQueue(const SpscQueue<ItemType>& copy) = delete;
+		~SpscQueue();
+
+		auto operator=(const SpscQueue<ItemType>& copy) -> SpscQueue<ItemType>& = delete;
+
+		auto Capacity() const -> int;
+		auto Count() const -> int;
+		auto IsEmpty() const -> bool;
+
+		auto TryAdd(ItemType&& item) -> bool;
+		auto TryAdd(const ItemType& item) -> bool;
+		auto TryRemove(ItemType& item) -> bool;
+
+		auto AddBatch(SequenceReference<ItemType> items) -> int;
+		auto RemoveBatch(SequenceReference<ItemType> items) -> int;
+
+	private:
+		static constexpr int CacheLineSize = 64;
+
+		ItemType* _items;
+		std::size_t _mask;
+
+		alignas(CacheLineSize) std::atomic<std::size_t> _head = 0;
+		std::size_t _cachedTail = 0;
+
+		alignas(CacheLineSize) std::atomic<std::size_t> _tail = 0;
+		std::size_t _cachedHead = 0;
+
+		template<typename... ConstructorParameterTypes> auto Emplace(ConstructorParameterTypes&&... constructorParameters) -> bool;
+	};
+
+	template<typename ItemType>
+	class MpmcQueue
+	{
+	public:
+		explicit MpmcQueue(int capacity);
+		MpmcQueue(const MpmcQueue<ItemType>& copy) = delete;
+		~MpmcQueue();
+
+		auto operator=(const MpmcQueue<ItemType>& copy) -> MpmcQueue<ItemType>& = delete;
+
+		auto Capacity() const -> int;
+		auto Count() const -> int;
+		auto IsEmpty() const -> bool;
+
+		auto TryAdd(ItemType&& item) -> bool;
+		auto TryAdd(const ItemType& item) -> bool;
+		auto TryRemove(ItemType& item) -> bool;
+
+		auto AddBatch(SequenceReference<ItemType> items) -> int;
+		auto RemoveBatch(SequenceReference<ItemType> items) -> int;
+
+	private:
+		static constexpr int CacheLineSize = 64;
+
+		struct Cell
+		{
+			std::atomic<std::size_t> Sequence;
+			alignas(ItemType) unsigned char Storage[sizeof(ItemType)];
+
+			auto Item() -> ItemType* { return std::launder(reinterpret_cast<ItemType*>(Storage)); }
+		};
+
+		std::unique_ptr<Cell[]> _cells;
+		std::size_t _mask;
+
+		alignas(CacheLineSize) std::atomic<std::size_t> _head = 0;
+		alignas(CacheLineSize) std::atomic<std::size_t> _tail = 0;
+
+		template<typename... ConstructorParameterTypes> auto Emplace(ConstructorParameterTypes&&... constructorParameters) -> bool;
+	};
+}
+
+template<typename ItemType>
+Pargon::SpscQueue<ItemType>::SpscQueue(int capacity) :
+	_items(static_cast<ItemType*>(::operator new(sizeof(ItemType) * capacity, std::align_val_t(alignof(ItemType))))),
+	_mask(static_cast<std::size_t>(capacity) - 1)
+{
+	assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+}
+
+template<typename ItemType>
+Pargon::SpscQueue<ItemType>::~SpscQueue()
+{
+	auto tail = _tail.load(std::memory_order_relaxed);
+
+	for (auto head = _head.load(std::memory_order_relaxed); head != tail; head++)
+		std::destroy_at(_items + (head & _mask));
+
+	::operator delete(_items, std::align_val_t(alignof(ItemType)));
+}
+
+template<typename ItemType>
+auto Pargon::SpscQueue<ItemType>::Capacity() const -> int
+{
+	return static_cast<int>(_mask + 1);
+}
+
+template<typename ItemType>
+auto Pargon::SpscQueue<ItemType>::Count() const -> int
+{
+	auto head = _head.load(std::memory_order_acquire);
+	auto tail = _tail.load(std::memory_order_acquire);
+	return tail > head ? static_cast<int>(tail - head) : 0;
+}
+
+template<typename ItemType>
+auto Pargon::SpscQueue<ItemType>::IsEmpty() const -> bool
+{
+	return Count() == 0;
+}
+
+template<typename ItemType>
+auto Pargon::SpscQueue<ItemType>::TryAdd(ItemType&& item) -> bool
+{
+	return Emplace(std::move(item));
+}
+
+template<typename ItemType>
+auto Pargon::SpscQueue<ItemType>::TryAdd(const ItemType& item) -> bool
+{
+	return Emplace(item);
+}
+
+template<typename ItemType>
+auto Pargon::SpscQueue<ItemType>::TryRemove(ItemType& item) -> bool
+{
+	auto head = _head.load(std::memory_order_relaxed);
+
+	if (head == _cachedTail)
+	{
+		_cachedTail = _tail.load(std::memory_order_acquire);
+		if (head == _cachedTail)
+			return false;
+	}
+
+	auto slot = _items + (head & _mask);
+	item = std::move(*slot);
+	std::destroy_at(slot);
+
+	_head.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename ItemType>
+auto Pargon::SpscQueue<ItemType>::AddBatch(SequenceReference<ItemType> items) -> int
+{
+	auto tail = _tail.load(std::memory_order_relaxed);
+	auto available = _mask + 1 - (tail - _cachedHead);
+
+	if (available < static_cast<std::size_t>(items.Count()))
+	{
+		_cachedHead = _head.load(std::memory_order_acquire);
+		available = _mask + 1 - (tail - _cachedHead);
+	}
+
+	auto count = available < static_cast<std::size_t>(items.Count()) ? static_cast<int>(available) : items.Count();
+
+	for (auto i = 0; i < count; i++)
+		::new(static_cast<void*>(_items + ((tail + i) & _mask))) ItemType(std::move(items.Item(i)));
+
+	_tail.store(tail + count, std::memory_order_release);
+	return count;
+}
+
+template<typename ItemType>
+auto Pargon::SpscQueue<ItemType>::RemoveBatch(SequenceReference<ItemType> items) -> int
+{
+	auto head = _head.load(std::memory_order_relaxed);
+	auto available = _cachedTail - head;
+
+	if (available < static_cast<std::size_t>(items.Count()))
+	{
+		_cachedTail = _tail.load(std::memory_order_acquire);
+		available = _cachedTail - head;
+	}
+
+	auto count = available < static_cast<std::size_t>(items.Count()) ? static_cast<int>(available) : items.Count();
+
+	for (auto i = 0; i < count; i++)
+	{
+		auto slot = _items + ((head + i) & _mask);
+		items.Item(i) = std::move(*slot);
+		std::destroy_at(slot);
+	}
+
+	_head.store(head + count, std::memory_order_release);
+	return count;
+}
+
+template<typename ItemType>
+template<typename... ConstructorParameterTypes>
+auto Pargon::SpscQueue<ItemType>::Emplace(ConstructorParameterTypes&&... constructorParameters) -> bool
+{
+	auto tail = _tail.load(std::memory_order_relaxed);
+
+	if (tail - _cachedHead > _mask)
+	{
+		_cachedHead = _head.load(std::memory_order_acquire);
+		if (tail - _cachedHead > _mask)
+			return false;
+	}
+
+	::new(static_cast<void*>(_items + (tail & _mask))) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+	_tail.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename ItemType>
+Pargon::MpmcQueue<ItemType>::MpmcQueue(int capacity) :
+	_cells(std::make_unique<Cell[]>(capacity)),
+	_mask(static_cast<std::size_t>(capacity) - 1)
+{
+	assert(capacity > 1 && (capacity & (capacity - 1)) == 0);
+
+	for (auto i = 0; i < capacity; i++)
+		_cells[i].Sequence.store(i, std::memory_order_relaxed);
+}
+
+template<typename ItemType>
+Pargon::MpmcQueue<ItemType>::~MpmcQueue()
+{
+	auto tail = _tail.load(std::memory_order_relaxed);
+
+	for (auto head = _head.load(std::memory_order_relaxed); head != tail; head++)
+		std::destroy_at(_cells[head & _mask].Item());
+}
+
+template<typename ItemType>
+auto Pargon::MpmcQueue<ItemType>::Capacity() const -> int
+{
+	return static_cast<int>(_mask + 1);
+}
+
+template<typename ItemType>
+auto Pargon::MpmcQueue<ItemType>::Count() const -> int
+{
+	auto head = _head.load(std::memory_order_acquire);
+	auto tail = _tail.load(std::memory_order_acquire);
+	return tail > head ? static_cast<int>(tail - head) : 0;
+}
+
+template<typename ItemType>
+auto Pargon::MpmcQueue<ItemType>::IsEmpty() const -> bool
+{
+	return Count() == 0;
+}
+
+template<typename ItemType>
+auto Pargon::MpmcQueue<ItemType>::TryAdd(ItemType&& item) -> bool
+{
+	return Emplace(std::move(item));
+}
+
+template<typename ItemType>
+auto Pargon::MpmcQueue<ItemType>::TryAdd(const ItemType& item) -> bool
+{
+	return Emplace(item);
+}
+
+template<typename ItemType>
+auto Pargon::MpmcQueue<ItemType>::TryRemove(ItemType& item) -> bool
+{
+	auto head = _head.load(std::memory_order_relaxed);
+	Cell* cell;
+
+	while (true)
+	{
+		cell = &_cells[head & _mask];
+		auto sequence = cell->Sequence.load(std::memory_order_acquire);
+		auto difference = static_cast<std::ptrdiff_t>(sequence - (head + 1));
+
+		if (difference == 0)
+		{
+			if (_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (difference < 0)
+		{
+			return false;
+		}
+		else
+		{
+			head = _head.load(std::memory_order_relaxed);
+		}
+	}
+
+	item = std::move(*cell->Item());
+	std::destroy_at(cell->Item());
+
+	cell->Sequence.store(head + _mask + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename ItemType>
+auto Pargon::MpmcQueue<ItemType>::AddBatch(SequenceReference<ItemType> items) -> int
+{
+	auto count = 0;
+
+	while (count < items.Count() && Emplace(std::move(items.Item(count))))
+		count++;
+
+	return count;
+}
+
+template<typename ItemType>
+auto Pargon::MpmcQueue<ItemType>::RemoveBatch(SequenceReference<ItemType> items) -> int
+{
+	auto count = 0;
+
+	while (count < items.Count() && TryRemove(items.Item(count)))
+		count++;
+
+	return count;
+}
+
+template<typename ItemType>
+template<typename... ConstructorParameterTypes>
+auto Pargon::MpmcQueue<ItemType>::Emplace(ConstructorParameterTypes&&... constructorParameters) -> bool
+{
+	auto tail = _tail.load(std::memory_order_relaxed);
+	Cell* cell;
+
+	while (true)
+	{
+		cell = &_cells[tail & _mask];
+		auto sequence = cell->Sequence.load(std::memory_order_acquire);
+		auto difference = static_cast<std::ptrdiff_t>(sequence - tail);
+
+		if (difference == 0)
+		{
+			if (_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (difference < 0)
+		{
+			return false;
+		}
+		else
+		{
+			tail = _tail.load(std::memory_order_relaxed);
+		}
+	}
+
+	::new(static_cast<void*>(cell->Storage)) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+
+	cell->Sequence.store(tail + 1, std::memory_order_release);
+	return true;
+}
@@ -0,0 +1,388 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType>
+	class Deque
+	{
+	public:
+		Deque() = default;
+		Deque(const Deque<ItemType>& copy);
+		Deque(Deque<ItemType>&& move);
+		~Deque();
+
+		auto operator=(const Deque<ItemType>& copy) -> Deque<ItemType>&;
+		auto operator=(Deque<ItemType>&& move) -> Deque<ItemType>&;
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto Capacity() const -> int;
+		auto LastIndex() const -> int;
+
+		auto First() -> ItemType&;
+		auto First() const -> const ItemType&;
+		auto Last() -> ItemType&;
+		auto Last() const -> const ItemType&;
+		auto Item(int index) -> ItemType&;
+		auto Item(int index) const -> const ItemType&;
+
+		auto GetFirstView() const -> SequenceView<ItemType>;
+		auto GetSecondView() const -> SequenceView<ItemType>;
+		auto GetFirstReference() -> SequenceReference<ItemType>;
+		auto GetSecondReference() -> SequenceReference<ItemType>;
+
+		void EnsureCapacity(int capacity);
+
+		auto AddFirst(ItemType&& item) -> ItemType&;
+		auto AddFirst(const ItemType& item) -> ItemType&;
+		auto AddLast(ItemType&& item) -> ItemType&;
+		auto AddLast(const ItemType& item) -> ItemType&;
+
+		auto RemoveFirst() -> bool;
+		auto RemoveLast() -> bool;
+
+		void Clear();
+
+	private:
+		static constexpr int MinimumCapacity = 8;
+
+		ItemType* _data = nullptr;
+		int _head = 0;
+		int _count = 0;
+		int _capacity = 0;
+
+		static auto Allocate(int capacity) -> ItemType*;
+		static void Deallocate(ItemType* data);
+
+		auto Slot(int index) const -> int;
+		auto FirstCount() const -> int;
+
+		void Rehome(ItemType* data, int capacity);
+		template<typename... ConstructorParameterTypes> auto Emplace(bool first, ConstructorParameterTypes&&... constructorParameters) -> ItemType&;
+	};
+}
+
+template<typename ItemType>
+Pargon::Deque<ItemType>::Deque(const Deque<ItemType>& copy)
+{
+	EnsureCapacity(copy._count);
+
+	for (auto i = 0; i < copy._count; i++)
+		AddLast(copy.Item(i));
+}
+
+template<typename ItemType>
+Pargon::Deque<ItemType>::Deque(Deque<ItemType>&& move) :
+	_data(move._data),
+	_head(move._head),
+	_count(move._count),
+	_capacity(move._capacity)
+{
+	move._data = nullptr;
+	move._head = 0;
+	move._count = 0;
+	move._capacity = 0;
+}
+
+template<typename ItemType>
+Pargon::Deque<ItemType>::~Deque()
+{
+	Clear();
+	Deallocate(_data);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::operator=(const Deque<ItemType>& copy) -> Deque<ItemType>&
+{
+	if (this != &copy)
+	{
+		Clear();
+		EnsureCapacity(copy._count);
+
+		for (auto i = 0; i < copy._count; i++)
+			AddLast(copy.Item(i));
+	}
+
+	return *this;
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::operator=(Deque<ItemType>&& move) -> Deque<ItemType>&
+{
+	if (this != &move)
+	{
+		Clear();
+		Deallocate(_data);
+
+		_data = move._data;
+		_head = move._head;
+		_count = move._count;
+		_capacity = move._capacity;
+
+		move._data = nullptr;
+		move._head = 0;
+		move._count = 0;
+		move._capacity = 0;
+	}
+
+	return *this;
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::IsEmpty() const -> bool
+{
+	return _count == 0;
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::Count() const -> int
+{
+	return _count;
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::Capacity() const -> int
+{
+	return _capacity;
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::LastIndex() const -> int
+{
+	return _count - 1;
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::First() -> ItemType&
+{
+	return Item(0);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::First() const -> const ItemType&
+{
+	return Item(0);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::Last() -> ItemType&
+{
+	return Item(_count - 1);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::Last() const -> const ItemType&
+{
+	return Item(_count - 1);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::Item(int index) -> ItemType&
+{
+	assert(index >= 0 && index < _count);
+	return _data[Slot(index)];
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::Item(int index) const -> const ItemType&
+{
+	assert(index >= 0 && index < _count);
+	return _data[Slot(index)];
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::GetFirstView() const -> SequenceView<ItemType>
+{
+	return SequenceView<ItemType>(_data + _head, FirstCount());
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::GetSecondView() const -> SequenceView<ItemType>
+{
+	return SequenceView<ItemType>(_data, _count - FirstCount());
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::GetFirstReference() -> SequenceReference<ItemType>
+{
+	return SequenceReference<ItemType>(_data + _head, FirstCount());
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::GetSecondReference() -> SequenceReference<ItemType>
+{
+	return SequenceReference<ItemType>(_data, _count - FirstCount());
+}
+
+template<typename ItemType>
+void Pargon::Deque<ItemType>::EnsureCapacity(int capacity)
+{
+	if (capacity <= _capacity)
+		return;
+
+	auto newCapacity = _capacity > 0 ? _capacity : MinimumCapacity;
+	while (newCapacity < capacity)
+		newCapacity *= 2;
+
+	Rehome(Allocate(newCapacity), newCapacity);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::AddFirst(ItemType&& item) -> ItemType&
+{
+	return Emplace(true, std::move(item));
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::AddFirst(const ItemType& item) -> ItemType&
+{
+	return Emplace(true, item);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::AddLast(ItemType&& item) -> ItemType&
+{
+	return Emplace(false, std::move(item));
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::AddLast(const ItemType& item) -> ItemType&
+{
+	return Emplace(false, item);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::RemoveFirst() -> bool
+{
+	if (_count == 0)
+		return false;
+
+	std::destroy_at(_data + _head);
+	_head = (_head + 1) & (_capacity - 1);
+	_count--;
+	return true;
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::RemoveLast() -> bool
+{
+	if (_count == 0)
+		return false;
+
+	std::destroy_at(_data + Slot(--_count));
+	return true;
+}
+
+template<typename ItemType>
+void Pargon::Deque<ItemType>::Clear()
+{
+	auto first = FirstCount();
+
+	std::destroy(_data + _head, _data + _head + first);
+	std::destroy(_data, _data + _count - first);
+
+	_head = 0;
+	_count = 0;
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::Allocate(int capacity) -> ItemType*
+{
+	return static_cast<ItemType*>(::operator new(sizeof(ItemType) * capacity, std::align_val_t(alignof(ItemType))));
+}
+
+template<typename ItemType>
+void Pargon::Deque<ItemType>::Deallocate(ItemType* data)
+{
+	if (data != nullptr)
+		::operator delete(data, std::align_val_t(alignof(ItemType)));
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::Slot(int index) const -> int
+{
+	return (_head + index) & (_capacity - 1);
+}
+
+template<typename ItemType>
+auto Pargon::Deque<ItemType>::FirstCount() const -> int
+{
+	return _count < _capacity - _head ? _count : _capacity - _head;
+}
+
+template<typename ItemType>
+void Pargon::Deque<ItemType>::Rehome(ItemType* data, int capacity)
+{
+	auto first = FirstCount();
+	auto second = _count - first;
+
+	if constexpr (IsTriviallyRelocatable<ItemType>::value)
+	{
+		if (first > 0)
+			std::memcpy(static_cast<void*>(data), static_cast<const void*>(_data + _head), sizeof(ItemType) * first);
+
+		if (second > 0)
+			std::memcpy(static_cast<void*>(data + first), static_cast<const void*>(_data), sizeof(ItemType) * second);
+	}
+	else
+	{
+		std::uninitialized_move(_data + _head, _data + _head + first, data);
+		std::uninitialized_move(_data, _data + second, data + first);
+		std::destroy(_data + _head, _data + _head + first);
+		std::destroy(_data, _data + second);
+	}
+
+	Deallocate(_data);
+
+	_data = data;
+	_head = 0;
+	_capacity = capacity;
+}
+
+template<typename ItemType>
+template<typename... ConstructorParameterTypes>
+auto Pargon::Deque<ItemType>::Emplace(bool first, ConstructorParameterTypes&&... constructorParameters) -> ItemType&
+{
+	if (_count == _capacity)
+	{
+		auto capacity = _capacity > 0 ? _capacity * 2 : MinimumCapacity;
+		auto data = Allocate(capacity);
+		auto slot = first ? capacity - 1 : _count;
+
+		try
+		{
+			::new(static_cast<void*>(data + slot)) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+		}
+		catch (...)
+		{
+			Deallocate(data);
+			throw;
+		}
+
+		Rehome(data, capacity);
+
+		if (first)
+			_head = slot;
+
+		_count++;
+		return _data[slot];
+	}
+
+	auto slot = first ? (_head - 1) & (_capacity - 1) : Slot(_count);
+	::new(static_cast<void*>(_data + slot)) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+
+	if (first)
+		_head = slot;
+
+	_count++;
+	return _data[slot];
+}
@@ -1,7 +1,13 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace Pargon
 {
@@ -9,58 +15,72 @@ namespace Pargon
 	class Function
 	{
 	public:
+		static constexpr int InlineSize = 40;
+
 		Function() = default;
 		Function(const Function<Signature>& copy) = delete;
-		Function(Function<Signature>&& move) = default;
-		~Function() = default;
+		Function(Function<Signature>&& move);
+		~Function();
 
 		auto operator=(const Function<Signature>& copy) -> Function<Signature>& = delete;
-		auto operator=(Function<Signature>&& move) -> Function<Signature>& = default;
+		auto operator=(Function<Signature>&& move) -> Function<Signature>&;
 
 		auto IsCallable() const -> bool;
+		auto IsInline() const -> bool;
 
 		template<typename... ParameterTypes> auto operator()(ParameterTypes&&... parameters) const -> decltype(auto)
 		{
-			return _details->Call(std::forward<ParameterTypes>(parameters)...);
+			return _operations->Call(_storage, std::forward<ParameterTypes>(parameters)...);
 		}
 
 	private:
-		template<typename _Signature> struct Details {};
+		template<typename CallableType> static constexpr bool IsInlineable = std::is_trivially_copyable<CallableType>::value && sizeof(CallableType) <= InlineSize && alignof(std::max_align_t) % alignof(CallableType) == 0;
+
+		template<typename _Signature> struct Operations {};
 		template<typename CallableType, typename _Signature> struct Caller {};
 
 		template<typename ReturnType, typename... ParameterTypes>
-		struct Details<ReturnType(ParameterTypes...)>
+		struct Operations<ReturnType(ParameterTypes...)>
 		{
-			virtual ~Details() = default;
-			virtual ReturnType Call(ParameterTypes... parameters) const = 0;
+			ReturnType(*Call)(const void* storage, ParameterTypes... parameters);
+			void(*Destroy)(void* storage);
+			bool Inline;
 		};
 
 		template<typename CallableType, typename ReturnType, typename... ParameterTypes>
-		struct Caller<CallableType, ReturnType(ParameterTypes...)> : Details<ReturnType(ParameterTypes...)>
+		struct Caller<CallableType, ReturnType(ParameterTypes...)>
 		{
-			Caller(Caller<CallableType, ReturnType(ParameterTypes...)>&& move) = default;
-
-			Caller(CallableType&& callable) :
-				_callable(std::move(callable))
+			static ReturnType Call(const void* storage, ParameterTypes... parameters)
 			{
+				if constexpr (IsInlineable<CallableType>)
+					return (*std::launder(reinterpret_cast<const CallableType*>(storage)))(std::forward<ParameterTypes>(parameters)...);
+				else
+					return static_cast<const CallableType&>(**std::launder(reinterpret_cast<CallableType* const*>(storage)))(std::forward<ParameterTypes>(parameters)...);
 			}
 
-			auto operator=(Caller<CallableType, ReturnType(ParameterTypes...)>&& move) -> Caller<CallableType, ReturnType(ParameterTypes...)>& = default;
-
-			ReturnType Call(ParameterTypes... parameters) const override
+			static void Destroy(void* storage)
 			{
-				return _callable(std::forward<ParameterTypes>(parameters)...);
+				delete *std::launder(reinterpret_cast<CallableType**>(storage));
 			}
 
-			CallableType _callable;
+			static constexpr Operations<ReturnType(ParameterTypes...)> Table = { &Call, IsInlineable<CallableType> ? nullptr : &Destroy, IsInlineable<CallableType> };
 		};
 
-		std::unique_ptr<Details<Signature>> _details;
+		alignas(std::max_align_t) unsigned char _storage[InlineSize];
+		const Operations<Signature>* _operations = nullptr;
+
+		void Reset();
 
 	public:
-		template<typename CallableType> Function(CallableType&& callable) :
-			_details(std::make_unique<Caller<CallableType, Signature>>(std::move(callable)))
+		template<typename CallableType, typename = std::enable_if_t<!std::is_same<std::decay_t<CallableType>, Function<Signature>>::value>> Function(CallableType&& callable) :
+			_operations(&Caller<std::decay_t<CallableType>, Signature>::Table)
 		{
+			using StoredType = std::decay_t<CallableType>;
+
+			if constexpr (IsInlineable<StoredType>)
+				new (_storage) StoredType(std::forward<CallableType>(callable));
+			else
+				new (_storage) StoredType*(new StoredType(std::forward<CallableType>(callable)));
 		}
 	};
 
@@ -111,10 +131,54 @@ namespace Pargon
 	};
 }
 
+template<typename Signature>
+Pargon::Function<Signature>::Function(Function<Signature>&& move) :
+	_operations(move._operations)
+{
+	std::memcpy(_storage, move._storage, InlineSize);
+	move._operations = nullptr;
+}
+
+template<typename Signature>
+Pargon::Function<Signature>::~Function()
+{
+	Reset();
+}
+
+template<typename Signature>
+auto Pargon::Function<Signature>::operator=(Function<Signature>&& move) -> Function<Signature>&
+{
+	if (this != &move)
+	{
+		Reset();
+
+		std::memcpy(_storage, move._storage, InlineSize);
+		_operations = move._operations;
+		move._operations = nullptr;
+	}
+
+	return *this;
+}
+
 template<typename Signature>
 auto Pargon::Function<Signature>::IsCallable() const -> bool
 {
-	return _details != nullptr;
+	return _operations != nullptr;
+}
+
+template<typename Signature>
+auto Pargon::Function<Signature>::IsInline() const -> bool
+{
+	return _operations != nullptr && _operations->Inline;
+}
+
+template<typename Signature>
+void Pargon::Function<Signature>::Reset()
+{
+	if (_operations != nullptr && _operations->Destroy != nullptr)
+		_operations->Destroy(_storage);
+
+	_operations = nullptr;
 }
 
 template<typename Signature>
@@ -0,0 +1,266 @@
+#pragma once
+
+#include "Pargon/Containers/Array.h"
+#include "Pargon/Containers/Buffer.h"
+#include "Pargon/Containers/Sequence.h"
+#include "Pargon/Containers/StridedView.h"
+
+#include <cassert>
+#include <type_traits>
+
+namespace Pargon
+{
+	template<typename ItemType, int Rank>
+	class GridView
+	{
+	public:
+		using ValueType = std::remove_const_t<ItemType>;
+		using SequenceType = std::conditional_t<std::is_const<ItemType>::value, SequenceView<ValueType>, SequenceReference<ValueType>>;
+		using BufferType = std::conditional_t<std::is_const<ItemType>::value, BufferView, BufferReference>;
+
+		GridView() = default;
+		GridView(ItemType* pointer, const Array<int, Rank>& extents);
+		GridView(ItemType* pointer, const Array<int, Rank>& extents, const Array<int, Rank>& strides);
+		GridView(SequenceType sequence, const Array<int, Rank>& extents);
+		GridView(BufferType buffer, const Array<int, Rank>& extents);
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto Extent(int dimension) const -> int;
+		auto Stride(int dimension) const -> int;
+		auto IsContiguous() const -> bool;
+		auto Data() const -> ItemType*;
+
+		template<typename... IndexTypes> auto Item(IndexTypes... indices) const -> ItemType&;
+		auto ItemAt(const Array<int, Rank>& indices) const -> ItemType&;
+
+		auto GetSubview(const Array<int, Rank>& start, const Array<int, Rank>& extents) const -> GridView<ItemType, Rank>;
+		auto Slice(int dimension, int index) const -> GridView<ItemType, Rank - 1>;
+		auto Line(const Array<int, Rank>& start, int dimension) const -> StridedView<ItemType>;
+
+		template<typename ActionType> void ForEach(ActionType action) const;
+
+	private:
+		static_assert(Rank > 0, "GridView requires a Rank of at least one");
+
+		template<typename, int> friend class GridView;
+
+		ItemType* _data = nullptr;
+		Array<int, Rank> _extents;
+		Array<int, Rank> _strides;
+
+		static auto ContiguousStrides(const Array<int, Rank>& extents) -> Array<int, Rank>;
+		static auto Product(const Array<int, Rank>& extents) -> int;
+
+		auto Offset(const Array<int, Rank>& indices) const -> long long;
+		template<int Dimension, typename ActionType> void ForEachIn(ItemType* data, ActionType& action) const;
+	};
+}
+
+template<typename ItemType, int Rank>
+Pargon::GridView<ItemType, Rank>::GridView(ItemType* pointer, const Array<int, Rank>& extents) :
+	GridView(pointer, extents, ContiguousStrides(extents))
+{
+}
+
+template<typename ItemType, int Rank>
+Pargon::GridView<ItemType, Rank>::GridView(ItemType* pointer, const Array<int, Rank>& extents, const Array<int, Rank>& strides) :
+	_data(pointer),
+	_extents(extents),
+	_strides(strides)
+{
+}
+
+template<typename ItemType, int Rank>
+Pargon::GridView<ItemType, Rank>::GridView(SequenceType sequence, const Array<int, Rank>& extents) :
+	GridView(sequence.begin(), extents)
+{
+	assert(Product(extents) <= sequence.Count());
+}
+
+template<typename ItemType, int Rank>
+Pargon::GridView<ItemType, Rank>::GridView(BufferType buffer, const Array<int, Rank>& extents) :
+	GridView(reinterpret_cast<ItemType*>(buffer.begin()), extents)
+{
+	assert(Product(extents) * static_cast<int>(sizeof(ItemType)) <= buffer.Size());
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::IsEmpty() const -> bool
+{
+	return Count() == 0;
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::Count() const -> int
+{
+	return Product(_extents);
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::Extent(int dimension) const -> int
+{
+	return _extents.Item(dimension);
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::Stride(int dimension) const -> int
+{
+	return _strides.Item(dimension);
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::IsContiguous() const -> bool
+{
+	auto expected = ContiguousStrides(_extents);
+
+	for (auto dimension = 0; dimension < Rank; dimension++)
+	{
+		if (_extents.Item(dimension) > 1 && _strides.Item(dimension) != expected.Item(dimension))
+			return false;
+	}
+
+	return true;
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::Data() const -> ItemType*
+{
+	return _data;
+}
+
+template<typename ItemType, int Rank>
+template<typename... IndexTypes>
+auto Pargon::GridView<ItemType, Rank>::Item(IndexTypes... indices) const -> ItemType&
+{
+	static_assert(sizeof...(IndexTypes) == Rank, "Item requires one index per dimension");
+	return ItemAt(Array<int, Rank>({ static_cast<int>(indices)... }));
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::ItemAt(const Array<int, Rank>& indices) const -> ItemType&
+{
+	return _data[Offset(indices)];
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::GetSubview(const Array<int, Rank>& start, const Array<int, Rank>& extents) const -> GridView<ItemType, Rank>
+{
+	for (auto dimension = 0; dimension < Rank; dimension++)
+	{
+		if (start.Item(dimension) < 0 || extents.Item(dimension) < 0 || start.Item(dimension) + extents.Item(dimension) > _extents.Item(dimension))
+			return {};
+	}
+
+	for (auto dimension = 0; dimension < Rank; dimension++)
+	{
+		if (extents.Item(dimension) == 0)
+			return { _data, extents, _strides };
+	}
+
+	return { _data + Offset(start), extents, _strides };
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::Slice(int dimension, int index) const -> GridView<ItemType, Rank - 1>
+{
+	static_assert(Rank > 1, "Slice requires a Rank of at least two");
+	assert(dimension >= 0 && dimension < Rank && index >= 0 && index < _extents.Item(dimension));
+
+	GridView<ItemType, Rank - 1> slice;
+	slice._data = _data + static_cast<long long>(_strides.Item(dimension)) * index;
+
+	for (auto from = 0, to = 0; from < Rank; from++)
+	{
+		if (from == dimension)
+			continue;
+
+		slice._extents.Item(to) = _extents.Item(from);
+		slice._strides.Item(to) = _strides.Item(from);
+		to++;
+	}
+
+	return slice;
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::Line(const Array<int, Rank>& start, int dimension) const -> StridedView<ItemType>
+{
+	assert(dimension >= 0 && dimension < Rank);
+	return { _data + Offset(start), _extents.Item(dimension) - start.Item(dimension), _strides.Item(dimension) * static_cast<int>(sizeof(ItemType)) };
+}
+
+template<typename ItemType, int Rank>
+template<typename ActionType>
+void Pargon::GridView<ItemType, Rank>::ForEach(ActionType action) const
+{
+	if (!IsEmpty())
+		ForEachIn<0>(_data, action);
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::ContiguousStrides(const Array<int, Rank>& extents) -> Array<int, Rank>
+{
+	Array<int, Rank> strides;
+	auto stride = 1;
+
+	for (auto dimension = Rank - 1; dimension >= 0; dimension--)
+	{
+		strides.Item(dimension) = stride;
+		stride *= extents.Item(dimension);
+	}
+
+	return strides;
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::Product(const Array<int, Rank>& extents) -> int
+{
+	auto product = 1;
+
+	for (auto extent : extents)
+		product *= extent;
+
+	return product;
+}
+
+template<typename ItemType, int Rank>
+auto Pargon::GridView<ItemType, Rank>::Offset(const Array<int, Rank>& indices) const -> long long
+{
+	auto offset = 0LL;
+
+	for (auto dimension = 0; dimension < Rank; dimension++)
+	{
+		assert(indices.Item(dimension) >= 0 && indices.Item(dimension) < _extents.Item(dimension));
+		offset += static_cast<long long>(indices.Item(dimension)) * _strides.Item(dimension);
+	}
+
+	return offset;
+}
+
+template<typename ItemType, int Rank>
+template<int Dimension, typename ActionType>
+void Pargon::GridView<ItemType, Rank>::ForEachIn(ItemType* data, ActionType& action) const
+{
+	auto extent = _extents.Item(Dimension);
+	auto stride = _strides.Item(Dimension);
+
+	if constexpr (Dimension == Rank - 1)
+	{
+		if (stride == 1)
+		{
+			for (auto i = 0; i < extent; i++)
+				action(data[i]);
+		}
+		else
+		{
+			for (auto i = 0; i < extent; i++)
+				action(data[static_cast<long long>(i) * stride]);
+		}
+	}
+	else
+	{
+		for (auto i = 0; i < extent; i++)
+			ForEachIn<Dimension + 1>(data + static_cast<long long>(i) * stride, action);
+	}
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "Pargon/Containers/Hash.h"
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Map.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Pargon
+{
+	template<typename KeyType>
+	struct GroupIndex
+	{
+		List<KeyType> Keys;
+		List<int> Starts;
+		List<int> Indices;
+
+		auto Count() const -> int;
+		auto Group(int group) const -> SequenceView<int>;
+	};
+
+	class Grouping
+	{
+	public:
+		template<typename KeyType, typename ItemType, typename KeySelectorType> static void Assign(SequenceView<ItemType> items, KeySelectorType& keySelector, List<KeyType>& keys, List<int>* groups);
+		static auto CountGroups(SequenceView<int> groups, int groupCount) -> List<int>;
+
+	private:
+		static auto Slot(std::size_t hash, int shift) -> int;
+	};
+}
+
+template<typename KeyType>
+auto Pargon::GroupIndex<KeyType>::Count() const -> int
+{
+	return Keys.Count();
+}
+
+template<typename KeyType>
+auto Pargon::GroupIndex<KeyType>::Group(int group) const -> SequenceView<int>
+{
+	return Indices.GetView(Starts.Item(group), Starts.Item(group + 1) - Starts.Item(group));
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::Distinct() const -> List<ItemType>
+{
+	auto identity = [](const ItemType& item) -> const ItemType& { return item; };
+
+	List<ItemType> items;
+	Grouping::Assign(*this, identity, items, nullptr);
+	return items;
+}
+
+template<typename ItemType>
+template<typename KeySelectorType>
+auto Pargon::SequenceView<ItemType>::GroupBy(KeySelectorType keySelector) const -> Map<GroupKey<KeySelectorType, ItemType>, List<ItemType>>
+{
+	List<GroupKey<KeySelectorType, ItemType>> keys;
+	List<int> groups;
+	Grouping::Assign(*this, keySelector, keys, &groups);
+
+	auto counts = Grouping::CountGroups(groups, keys.Count());
+
+	Map<GroupKey<KeySelectorType, ItemType>, List<ItemType>> map;
+	map.EnsureCapacity(keys.Count());
+
+	for (auto group = 0; group < keys.Count(); group++)
+		map.AddOrSet(keys.Item(group), List<ItemType>()).EnsureCapacity(counts.Item(group));
+
+	for (auto i = 0; i < _count; i++)
+		map.ItemAtIndex(groups.Item(i)).Add(_data[i]);
+
+	return map;
+}
+
+template<typename ItemType>
+template<typename KeySelectorType>
+auto Pargon::SequenceView<ItemType>::GroupIndices(KeySelectorType keySelector) const -> GroupIndex<GroupKey<KeySelectorType, ItemType>>
+{
+	GroupIndex<GroupKey<KeySelectorType, ItemType>> index;
+	List<int> groups;
+	Grouping::Assign(*this, keySelector, index.Keys, &groups);
+
+	auto counts = Grouping::CountGroups(groups, index.Keys.Count());
+
+	index.Starts.SetCount(index.Keys.Count() + 1);
+	index.Starts.Item(0) = 0;
+
+	for (auto group = 0; group < index.Keys.Count(); group++)
+		index.Starts.Item(group + 1) = index.Starts.Item(group) + counts.Item(group);
+
+	index.Indices.SetCount(_count);
+
+	for (auto i = 0; i < _count; i++)
+	{
+		auto group = groups.Item(i);
+		index.Indices.Item(index.Starts.Item(group + 1) - counts.Item(group)) = i;
+		counts.Item(group)--;
+	}
+
+	return index;
+}
+
+template<typename ItemType>
+template<typename KeySelectorType>
+auto Pargon::SequenceView<ItemType>::CountBy(KeySelectorType keySelector) const -> Map<GroupKey<KeySelectorType, ItemType>, int>
+{
+	List<GroupKey<KeySelectorType, ItemType>> keys;
+	List<int> groups;
+	Grouping::Assign(*this, keySelector, keys, &groups);
+
+	auto counts = Grouping::CountGroups(groups, keys.Count());
+
+	Map<GroupKey<KeySelectorType, ItemType>, int> map;
+	map.EnsureCapacity(keys.Count());
+
+	for (auto group = 0; group < keys.Count(); group++)
+		map.AddOrSet(keys.Item(group), counts.Item(group));
+
+	return map;
+}
+
+template<typename KeyType, typename ItemType, typename KeySelectorType>
+void Pargon::Grouping::Assign(SequenceView<ItemType> items, KeySelectorType& keySelector, List<KeyType>& keys, List<int>* groups)
+{
+	static_assert(IsHashable<KeyType>, "KeyType is not hashable and therefore cannot be used to group items");
+
+	auto shift = 64;
+	auto capacity = 1;
+
+	while (capacity < items.Count() * 2)
+	{
+		capacity *= 2;
+		shift--;
+	}
+
+	List<int> slots;
+	slots.SetCount(capacity, Sequence::InvalidIndex);
+
+	List<std::size_t> hashes;
+	hashes.EnsureCapacity(items.Count());
+	keys.EnsureCapacity(items.Count());
+
+	if (groups != nullptr)
+		groups->SetCount(items.Count());
+
+	for (auto i = 0; i < items.Count(); i++)
+	{
+		decltype(auto) key = keySelector(items.Item(i));
+		auto hash = static_cast<std::size_t>(Hasher<KeyType>{}(key));
+		auto slot = Slot(hash, shift);
+
+		while (slots.Item(slot) != Sequence::InvalidIndex)
+		{
+			auto existing = slots.Item(slot);
+
+			if (hashes.Item(existing) == hash && keys.Item(existing) == key)
+				break;
+
+			slot = (slot + 1) & (capacity - 1);
+		}
+
+		if (slots.Item(slot) == Sequence::InvalidIndex)
+		{
+			slots.Item(slot) = keys.Count();
+			hashes.Add(hash);
+			keys.Add(key);
+		}
+
+		if (groups != nullptr)
+			groups->Item(i) = slots.Item(slot);
+	}
+}
+
+inline auto Pargon::Grouping::CountGroups(SequenceView<int> groups, int groupCount) -> List<int>
+{
+	List<int> counts;
+	counts.SetCount(groupCount, 0);
+
+	for (auto group : groups)
+		counts.Item(group)++;
+
+	return counts;
+}
+
+inline auto Pargon::Grouping::Slot(std::size_t hash, int shift) -> int
+{
+	return static_cast<int>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> shift);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+
+namespace Pargon
+{
+	namespace Hashing
+	{
+		template<typename T, typename = void> struct HasHashMember : std::false_type {};
+		template<typename T, typename = void> struct HasHashFunction : std::false_type {};
+		template<typename T> struct HasHashMember<T, std::void_t<decltype(std::declval<const T>().GetHash())>> : std::true_type {};
+		template<typename T> struct HasHashFunction<T, std::void_t<decltype(GetHash(std::declval<T>()))>> : std::true_type {};
+	}
+
+	template<typename T> constexpr bool IsHashable = Hashing::HasHashMember<T>::value || Hashing::HasHashFunction<T>::value || std::is_arithmetic<T>::value || std::is_same<T, std::type_index>::value;
+
+	template<typename T>
+	struct Hasher
+	{
+		auto operator()(const T& item) const -> std::size_t
+		{
+			if constexpr (Hashing::HasHashMember<T>::value)
+				return item.GetHash();
+			else if constexpr (Hashing::HasHashFunction<T>::value)
+				return GetHash(item);
+			else if constexpr (std::is_arithmetic<T>::value || std::is_same<T, std::type_index>::value)
+				return std::hash<T>{}(item);
+		}
+	};
+}
@@ -5,10 +5,29 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 namespace Pargon
 {
+	class Buffer;
+	class String;
+
+	template<typename ItemType> struct IsTriviallyRelocatable : std::is_trivially_copyable<ItemType> {};
+	template<typename ItemType> struct IsTriviallyRelocatable<List<ItemType>> : std::true_type {};
+	template<typename ItemType> struct IsTriviallyRelocatable<std::unique_ptr<ItemType>> : std::true_type {};
+	template<typename Signature> struct IsTriviallyRelocatable<Function<Signature>> : std::true_type {};
+	template<> struct IsTriviallyRelocatable<Buffer> : std::true_type {};
+
+#if defined(_LIBCPP_VERSION) || (defined(_MSC_VER) && _ITERATOR_DEBUG_LEVEL == 0)
+	template<> struct IsTriviallyRelocatable<String> : std::true_type {};
+#endif
+
 	template<typename ItemType>
 	class List
 	{
@@ -17,11 +36,16 @@ namespace Pargon
 		using ConstIterator = const ItemType*;
 
 		List() = default;
+		List(const List<ItemType>& copy);
+		List(List<ItemType>&& move);
 		List(std::vector<ItemType>&& vector);
 		List(SequenceView<ItemType> view);
 		List(int count, const ItemType& copy);
 		List(const std::initializer_list<ItemType>& initializer);
+		~List();
 
+		auto operator=(const List<ItemType>& copy) -> List<ItemType>&;
+		auto operator=(List<ItemType>&& move) -> List<ItemType>&;
 		auto operator=(SequenceView<ItemType> view) -> List<ItemType>&;
 		auto operator=(const std::initializer_list<ItemType>& initializer) -> List<ItemType>&;
 
@@ -56,6 +80,8 @@ namespace Pargon
 		void EnsureCount(int count);
 		void EnsureCount(int count, const ItemType& copy);
 		void EnsureCapacity(int capacity);
+		void SetCountUninitialized(int count);
+		auto ReserveUninitialized(int count) -> SequenceReference<ItemType>;
 
 		auto Add(ItemType&& item) -> ItemType&;
 		auto Add(const ItemType& item) -> ItemType&;
@@ -74,88 +100,200 @@ namespace Pargon
 		void Clear();
 
 	private:
-		std::vector<ItemType> _vector;
+		static constexpr bool IsUninitializable = std::is_trivially_default_constructible<ItemType>::value && std::is_trivially_destructible<ItemType>::value;
+		static constexpr bool IsRelocatable = IsTriviallyRelocatable<ItemType>::value;
+		static constexpr bool IsReallocatable = IsRelocatable && alignof(ItemType) <= alignof(std::max_align_t);
+
+		ItemType* _data = nullptr;
+		int _count = 0;
+		int _capacity = 0;
+
+		static auto Allocate(int capacity) -> ItemType*;
+		static void Deallocate(ItemType* data);
+		static void Relocate(ItemType* to, ItemType* from, int count);
+
+		auto GrowthCapacity(int count) const -> int;
+		void Reallocate(int capacity);
+		void Grow(int count);
+
+		template<typename... ConstructorParameterTypes> auto Emplace(int index, ConstructorParameterTypes&&... constructorParameters) -> ItemType&;
 	};
 }
 
 template<typename ItemType>
-Pargon::List<ItemType>::List(std::vector<ItemType>&& vector) :
-	_vector(std::move(vector))
+Pargon::List<ItemType>::List(const List<ItemType>& copy)
 {
+	try
+	{
+		EnsureCapacity(copy._count);
+		std::uninitialized_copy(copy.begin(), copy.end(), _data);
+	}
+	catch (...)
+	{
+		Deallocate(_data);
+		throw;
+	}
+
+	_count = copy._count;
 }
 
 template<typename ItemType>
-Pargon::List<ItemType>::List(SequenceView<ItemType> view) :
-	_vector(view.begin(), view.end())
+Pargon::List<ItemType>::List(List<ItemType>&& move) :
+	_data(move._data),
+	_count(move._count),
+	_capacity(move._capacity)
 {
+	move._data = nullptr;
+	move._count = 0;
+	move._capacity = 0;
+}
+
+template<typename ItemType>
+Pargon::List<ItemType>::List(std::vector<ItemType>&& vector)
+{
+	try
+	{
+		EnsureCapacity(static_cast<int>(vector.size()));
+		std::uninitialized_move(vector.begin(), vector.end(), _data);
+	}
+	catch (...)
+	{
+		Deallocate(_data);
+		throw;
+	}
+
+	_count = static_cast<int>(vector.size());
+}
+
+template<typename ItemType>
+Pargon::List<ItemType>::List(SequenceView<ItemType> view)
+{
+	try
+	{
+		EnsureCapacity(view.Count());
+		std::uninitialized_copy(view.begin(), view.end(), _data);
+	}
+	catch (...)
+	{
+		Deallocate(_data);
+		throw;
+	}
+
+	_count = view.Count();
 }
 
 template<typename ItemType>
 Pargon::List<ItemType>::List(int count, const ItemType& copy)
 {
-	_vector.resize(count, copy);
+	try
+	{
+		SetCount(count, copy);
+	}
+	catch (...)
+	{
+		Deallocate(_data);
+		throw;
+	}
 }
 
 template<typename ItemType>
 Pargon::List<ItemType>::List(const std::initializer_list<ItemType>& initializer) :
-	_vector(initializer)
+	List(SequenceView<ItemType>(initializer))
+{
+}
+
+template<typename ItemType>
+Pargon::List<ItemType>::~List()
+{
+	std::destroy(begin(), end());
+	Deallocate(_data);
+}
+
+template<typename ItemType>
+auto Pargon::List<ItemType>::operator=(const List<ItemType>& copy) -> List<ItemType>&
+{
+	if (this != &copy)
+		*this = copy.GetView();
+
+	return *this;
+}
+
+template<typename ItemType>
+auto Pargon::List<ItemType>::operator=(List<ItemType>&& move) -> List<ItemType>&
 {
+	if (this != &move)
+	{
+		std::destroy(begin(), end());
+		Deallocate(_data);
+
+		_data = move._data;
+		_count = move._count;
+		_capacity = move._capacity;
+
+		move._data = nullptr;
+		move._count = 0;
+		move._capacity = 0;
+	}
+
+	return *this;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::operator=(SequenceView<ItemType> view) -> List<ItemType>&
 {
-	_vector.assign(view.begin(), view.end());
+	Clear();
+	EnsureCapacity(view.Count());
+	std::uninitialized_copy(view.begin(), view.end(), _data);
+	_count = view.Count();
 	return *this;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::operator=(const std::initializer_list<ItemType>& initializer) -> List<ItemType>&
 {
-	_vector = initializer;
-	return *this;
+	return *this = SequenceView<ItemType>(initializer);
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::begin() -> Iterator
 {
-	return _vector.data();
+	return _data;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::begin() const -> ConstIterator
 {
-	return _vector.data();
+	return _data;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::end() -> Iterator
 {
-	return _vector.data() + _vector.size();
+	return _data + _count;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::end() const -> ConstIterator
 {
-	return _vector.data() + _vector.size();
+	return _data + _count;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::IsEmpty() const -> bool
 {
-	return _vector.empty();
+	return _count == 0;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Count() const -> int
 {
-	return static_cast<int>(_vector.size());
+	return _count;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Capacity() const -> int
 {
-	return static_cast<int>(_vector.capacity());
+	return _capacity;
 }
 
 template<typename ItemType>
@@ -167,57 +305,57 @@ auto Pargon::List<ItemType>::LastIndex() const -> int
 template<typename ItemType>
 auto Pargon::List<ItemType>::First() -> ItemType&
 {
-	assert(!_vector.empty());
-	return _vector.front();
+	assert(_count != 0);
+	return _data[0];
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::First() const -> const ItemType&
 {
-	assert(!_vector.empty());
-	return _vector.front();
+	assert(_count != 0);
+	return _data[0];
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Last() -> ItemType&
 {
-	assert(!_vector.empty());
-	return _vector.back();
+	assert(_count != 0);
+	return _data[_count - 1];
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Last() const -> const ItemType&
 {
-	assert(!_vector.empty());
-	return _vector.back();
+	assert(_count != 0);
+	return _data[_count - 1];
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Item(int index) -> ItemType&
 {
 	assert(index < Count());
-	return _vector[index];
+	return _data[index];
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Item(int index) const -> const ItemType&
 {
 	assert(index < Count());
-	return _vector[index];
+	return _data[index];
 }
 
 template<typename ItemType>
 void Pargon::List<ItemType>::SetItem(int index, ItemType&& value)
 {
 	assert(index < Count());
-	_vector[index] = std::move(value);
+	_data[index] = std::move(value);
 }
 
 template<typename ItemType>
 void Pargon::List<ItemType>::SetItem(int index, const ItemType& value)
 {
 	assert(index < Count());
-	_vector[index] = value;
+	_data[index] = value;
 }
 
 template<typename ItemType>
@@ -238,7 +376,7 @@ auto Pargon::List<ItemType>::GetView(int start, int count) const -> SequenceView
 	if (start < 0 || start + count > Count())
 		return {};
 
-	return { begin() + start, count };
+	return SequenceView<ItemType>(begin() + start, count);
 }
 
 template<typename ItemType>
@@ -265,95 +403,125 @@ auto Pargon::List<ItemType>::GetReference(int start, int count) -> SequenceRefer
 template<typename ItemType>
 void Pargon::List<ItemType>::SetCount(int count)
 {
-	_vector.resize(count);
+	if (count < _count)
+	{
+		std::destroy(_data + count, _data + _count);
+	}
+	else if (count > _count)
+	{
+		Grow(count);
+		std::uninitialized_value_construct(_data + _count, _data + count);
+	}
+
+	_count = count;
 }
 
 template<typename ItemType>
 void Pargon::List<ItemType>::SetCount(int count, const ItemType& copy)
 {
-	_vector.resize(count, copy);
+	if (count < _count)
+	{
+		std::destroy(_data + count, _data + _count);
+	}
+	else if (count > _capacity)
+	{
+		ItemType item(copy);
+		Grow(count);
+		std::uninitialized_fill(_data + _count, _data + count, item);
+	}
+	else if (count > _count)
+	{
+		std::uninitialized_fill(_data + _count, _data + count, copy);
+	}
+
+	_count = count;
 }
 
 template<typename ItemType>
 void Pargon::List<ItemType>::EnsureCount(int count)
 {
-	if (count > static_cast<int>(_vector.size()))
-		_vector.resize(count);
+	if (count > _count)
+		SetCount(count);
 }
 
 template<typename ItemType>
 void Pargon::List<ItemType>::EnsureCount(int count, const ItemType& copy)
 {
-	if (count > static_cast<int>(_vector.size()))
-		_vector.resize(count, copy);
+	if (count > _count)
+		SetCount(count, copy);
 }
 
 template<typename ItemType>
 void Pargon::List<ItemType>::EnsureCapacity(int capacity)
 {
-	_vector.reserve(capacity);
+	if (capacity > _capacity)
+		Reallocate(capacity);
+}
+
+template<typename ItemType>
+void Pargon::List<ItemType>::SetCountUninitialized(int count)
+{
+	static_assert(IsUninitializable, "SetCountUninitialized requires an ItemType that is trivially constructible and destructible");
+
+	Grow(count);
+	_count = count;
+}
+
+template<typename ItemType>
+auto Pargon::List<ItemType>::ReserveUninitialized(int count) -> SequenceReference<ItemType>
+{
+	static_assert(IsUninitializable, "ReserveUninitialized requires an ItemType that is trivially constructible and destructible");
+
+	auto start = _count;
+	SetCountUninitialized(start + count);
+	return { begin() + start, count };
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Add(ItemType&& item) -> ItemType&
 {
-	_vector.push_back(std::move(item));
-	return _vector.back();
+	return Emplace(_count, std::move(item));
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Add(const ItemType& item) -> ItemType&
 {
-	_vector.push_back(item);
-	return _vector.back();
+	return Emplace(_count, item);
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Insert(ItemType&& item, int index) -> ItemType&
 {
 	assert(index <= Count());
-
-	auto iterator = _vector.begin() + index;
-	_vector.insert(iterator, std::move(item));
-	return _vector[index];
+	return Emplace(index, std::move(item));
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Insert(const ItemType& item, int index) -> ItemType&
 {
 	assert(index <= Count());
-
-	auto iterator = _vector.begin() + index;
-	_vector.insert(iterator, item);
-	return _vector[index];
+	return Emplace(index, item);
 }
 
 template<typename ItemType>
 template<typename... ConstructorParameterTypes>
 auto Pargon::List<ItemType>::Increment(ConstructorParameterTypes&&... constructorParameters) -> ItemType&
 {
-	_vector.emplace_back(std::forward<ConstructorParameterTypes>(constructorParameters)...);
-	return _vector.back();
+	return Emplace(_count, std::forward<ConstructorParameterTypes>(constructorParameters)...);
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::Find(const ItemType& item) const -> int
 {
-	for (auto i = 0u; i < _vector.size(); i++)
-	{
-		if (item == _vector[i])
-			return i;
-	}
-
-	return Sequence::InvalidIndex;
+	return GetView().IndexOf(item);
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::FindWhere(FunctionView<bool(const ItemType&)> predicate) const -> int
 {
-	for (auto i = 0u; i < _vector.size(); i++)
+	for (auto i = 0; i < _count; i++)
 	{
-		if (predicate(_vector[i]))
+		if (predicate(_data[i]))
 			return i;
 	}
 
@@ -363,12 +531,7 @@ auto Pargon::List<ItemType>::FindWhere(FunctionView<bool(const ItemType&)> predi
 template<typename ItemType>
 auto Pargon::List<ItemType>::Remove(const ItemType& item) -> bool
 {
-	auto iterator = std::find(_vector.begin(), _vector.end(), item);
-	if (iterator == _vector.end())
-		return false;
-
-	_vector.erase(iterator);
-	return true;
+	return RemoveAt(Find(item));
 }
 
 template<typename ItemType>
@@ -376,9 +539,9 @@ auto Pargon::List<ItemType>::RemoveWhere(FunctionView<bool(const ItemType&)> pre
 {
 	auto removed = false;
 
-	for (auto i = 0u; i < _vector.size(); i++)
+	for (auto i = 0; i < _count; i++)
 	{
-		if (predicate(_vector[i]))
+		if (predicate(_data[i]))
 		{
 			RemoveAt(i--);
 			removed = true;
@@ -391,29 +554,207 @@ auto Pargon::List<ItemType>::RemoveWhere(FunctionView<bool(const ItemType&)> pre
 template<typename ItemType>
 auto Pargon::List<ItemType>::RemoveAt(int index) -> bool
 {
-	if (index < 0 || index >= static_cast<int>(_vector.size()))
+	if (index < 0 || index >= _count)
 		return false;
 
-	auto iterator = _vector.begin() + index;
-	_vector.erase(iterator);
+	if constexpr (IsRelocatable)
+	{
+		std::destroy_at(_data + index);
+		Relocate(_data + index, _data + index + 1, _count - index - 1);
+	}
+	else
+	{
+		std::move(_data + index + 1, _data + _count, _data + index);
+		std::destroy_at(_data + _count - 1);
+	}
+
+	_count--;
 	return true;
 }
 
 template<typename ItemType>
 auto Pargon::List<ItemType>::RemoveLast() -> bool
 {
-	if (_vector.empty())
+	if (_count == 0)
 		return false;
 
-	auto iterator = _vector.end() - 1;
-	_vector.erase(iterator);
+	std::destroy_at(_data + --_count);
 	return true;
 }
 
 template<typename ItemType>
 void Pargon::List<ItemType>::Clear()
 {
-	_vector.clear();
+	std::destroy(begin(), end());
+	_count = 0;
+}
+
+template<typename ItemType>
+auto Pargon::List<ItemType>::Allocate(int capacity) -> ItemType*
+{
+	if constexpr (IsReallocatable)
+	{
+		auto data = std::malloc(sizeof(ItemType) * capacity);
+		if (data == nullptr)
+			throw std::bad_alloc();
+
+		return static_cast<ItemType*>(data);
+	}
+	else
+	{
+		return static_cast<ItemType*>(::operator new(sizeof(ItemType) * capacity, std::align_val_t(alignof(ItemType))));
+	}
+}
+
+template<typename ItemType>
+void Pargon::List<ItemType>::Deallocate(ItemType* data)
+{
+	if constexpr (IsReallocatable)
+		std::free(data);
+	else
+		::operator delete(data, std::align_val_t(alignof(ItemType)));
+}
+
+template<typename ItemType>
+void Pargon::List<ItemType>::Relocate(ItemType* to, ItemType* from, int count)
+{
+	if (count > 0)
+		std::memmove(static_cast<void*>(to), static_cast<const void*>(from), sizeof(ItemType) * count);
+}
+
+template<typename ItemType>
+auto Pargon::List<ItemType>::GrowthCapacity(int count) const -> int
+{
+	auto capacity = _capacity + _capacity / 2;
+	return count > capacity ? count : capacity;
+}
+
+template<typename ItemType>
+void Pargon::List<ItemType>::Reallocate(int capacity)
+{
+	if constexpr (IsReallocatable)
+	{
+		auto data = std::realloc(static_cast<void*>(_data), sizeof(ItemType) * capacity);
+		if (data == nullptr)
+			throw std::bad_alloc();
+
+		_data = static_cast<ItemType*>(data);
+	}
+	else
+	{
+		auto data = Allocate(capacity);
+
+		if constexpr (IsRelocatable)
+		{
+			Relocate(data, _data, _count);
+		}
+		else
+		{
+			try
+			{
+				std::uninitialized_move(_data, _data + _count, data);
+			}
+			catch (...)
+			{
+				Deallocate(data);
+				throw;
+			}
+
+			std::destroy(_data, _data + _count);
+		}
+
+		Deallocate(_data);
+		_data = data;
+	}
+
+	_capacity = capacity;
+}
+
+template<typename ItemType>
+void Pargon::List<ItemType>::Grow(int count)
+{
+	if (count > _capacity)
+		Reallocate(GrowthCapacity(count));
+}
+
+template<typename ItemType>
+template<typename... ConstructorParameterTypes>
+auto Pargon::List<ItemType>::Emplace(int index, ConstructorParameterTypes&&... constructorParameters) -> ItemType&
+{
+	if (index == _count && _count < _capacity)
+	{
+		::new(static_cast<void*>(_data + index)) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+	}
+	else if constexpr (IsRelocatable)
+	{
+		alignas(ItemType) unsigned char storage[sizeof(ItemType)];
+		::new(static_cast<void*>(storage)) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+
+		try
+		{
+			Grow(_count + 1);
+		}
+		catch (...)
+		{
+			std::destroy_at(reinterpret_cast<ItemType*>(storage));
+			throw;
+		}
+
+		Relocate(_data + index + 1, _data + index, _count - index);
+		Relocate(_data + index, reinterpret_cast<ItemType*>(storage), 1);
+	}
+	else if (_count == _capacity)
+	{
+		auto capacity = GrowthCapacity(_count + 1);
+		auto data = Allocate(capacity);
+
+		try
+		{
+			::new(static_cast<void*>(data + index)) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+		}
+		catch (...)
+		{
+			Deallocate(data);
+			throw;
+		}
+
+		try
+		{
+			std::uninitialized_move(_data, _data + index, data);
+
+			try
+			{
+				std::uninitialized_move(_data + index, _data + _count, data + index + 1);
+			}
+			catch (...)
+			{
+				std::destroy(data, data + index);
+				throw;
+			}
+		}
+		catch (...)
+		{
+			std::destroy_at(data + index);
+			Deallocate(data);
+			throw;
+		}
+
+		std::destroy(_data, _data + _count);
+		Deallocate(_data);
+
+		_data = data;
+		_capacity = capacity;
+	}
+	else
+	{
+		ItemType item(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+		::new(static_cast<void*>(_data + _count)) ItemType(std::move(_data[_count - 1]));
+		std::move_backward(_data + index, _data + _count - 1, _data + _count);
+		_data[index] = std::move(item);
+	}
+
+	_count++;
+	return _data[index];
 }
 
 template<typename ItemType>
@@ -429,3 +770,141 @@ Pargon::SequenceReference<ItemType>::SequenceReference(List<ItemType>& list) :
 	_count(list.Count())
 {
 }
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::IndicesOf(const ItemType& item) const -> List<int>
+{
+	List<int> indices;
+	indices.SetCountUninitialized(CountOf(item));
+	Searching::IndicesOf(_data, _count, item, indices.begin());
+	return indices;
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::SortedUnion(SequenceView<ItemType> other) const -> List<ItemType>
+{
+	List<ItemType> items;
+	items.EnsureCapacity(_count + other._count);
+
+	auto left = 0;
+	auto right = 0;
+
+	while (left < _count && right < other._count)
+	{
+		if (other._data[right] < _data[left])
+		{
+			items.Add(other._data[right++]);
+		}
+		else
+		{
+			if (!(_data[left] < other._data[right]))
+				right++;
+
+			items.Add(_data[left++]);
+		}
+	}
+
+	for (; left < _count; left++)
+		items.Add(_data[left]);
+
+	for (; right < other._count; right++)
+		items.Add(other._data[right]);
+
+	return items;
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::SortedIntersection(SequenceView<ItemType> other) const -> List<ItemType>
+{
+	auto& small = _count <= other._count ? *this : other;
+	auto& large = _count <= other._count ? other : *this;
+
+	List<ItemType> items;
+
+	if (small._count == 0)
+		return items;
+
+	items.EnsureCapacity(small._count);
+
+	if (large._count / small._count >= GallopRatio)
+	{
+		auto position = 0;
+
+		for (auto& item : small)
+		{
+			position = large.Gallop(position, item);
+			if (position == large._count)
+				break;
+
+			if (!(item < large._data[position]))
+				items.Add(large._data[position++]);
+		}
+	}
+	else
+	{
+		auto left = 0;
+		auto right = 0;
+
+		while (left < small._count && right < large._count)
+		{
+			auto& smallItem = small._data[left];
+			auto& largeItem = large._data[right];
+
+			if (smallItem < largeItem)
+			{
+				left++;
+			}
+			else if (largeItem < smallItem)
+			{
+				right++;
+			}
+			else
+			{
+				items.Add(smallItem);
+				left++;
+				right++;
+			}
+		}
+	}
+
+	return items;
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::SortedDifference(SequenceView<ItemType> other) const -> List<ItemType>
+{
+	List<ItemType> items;
+	items.EnsureCapacity(_count);
+
+	auto left = 0;
+	auto right = 0;
+	auto gallop = _count == 0 || other._count / _count >= GallopRatio;
+
+	while (left < _count && right < other._count)
+	{
+		if (gallop)
+			right = other.Gallop(right, _data[left]);
+
+		if (right == other._count)
+			break;
+
+		if (_data[left] < other._data[right])
+		{
+			items.Add(_data[left++]);
+		}
+		else if (other._data[right] < _data[left])
+		{
+			right++;
+		}
+		else
+		{
+			left++;
+			right++;
+		}
+	}
+
+	for (; left < _count; left++)
+		items.Add(_data[left]);
+
+	return items;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Pargon/Containers/Hash.h"
 #include "Pargon/Containers/Sequence.h"
 
 #include <cassert>
@@ -56,31 +57,11 @@ namespace Pargon
 		void RemoveAtIndex(int index);
 		void RemoveWhere(FunctionView<bool(const KeyType&, const ItemType&)> predicate);
 
+		void EnsureCapacity(int capacity);
 		void Clear();
 
 	private:
-		template<typename T> using void_t = void;
-		template<typename T, typename = void> struct has_get_hash_member : std::false_type {};
-		template<typename T, typename = void> struct has_get_hash_function : std::false_type {};
-		template<typename T> struct has_get_hash_member<T, void_t<decltype(std::declval<const T>().GetHash())>> : std::true_type {};
-		template<typename T> struct has_get_hash_function<T, void_t<decltype(GetHash(std::declval<T>()))>> : std::true_type {};
-		static constexpr bool IsHashable = has_get_hash_member<KeyType>::value || has_get_hash_function<KeyType>::value || std::is_arithmetic<KeyType>::value || std::is_same<KeyType, std::type_index>::value;
-
-		static_assert(IsHashable, "KeyType is not hashable and therefore cannot be used as the key type for a Map");
-
-		template<typename T>
-		struct Hasher
-		{
-			auto operator()(const T& item) const -> std::size_t
-			{
-				if constexpr (has_get_hash_member<T>::value)
-					return item.GetHash();
-				else if constexpr (has_get_hash_function<T>::value)
-					return GetHash(item);
-				else if constexpr (std::is_arithmetic<T>::value || std::is_same<T, std::type_index>::value)
-					return std::hash<T>{}(item);
-			}
-		};
+		static_assert(IsHashable<KeyType>, "KeyType is not hashable and therefore cannot be used as the key type for a Map");
 
 		std::unordered_map<KeyType, int, Hasher<KeyType>> _map;
 		std::vector<KeyType> _keys;
@@ -325,6 +306,14 @@ void Pargon::Map<KeyType, ItemType>::RemoveWhere(FunctionView<bool(const KeyType
 	}
 }
 
+template<typename KeyType, typename ItemType>
+void Pargon::Map<KeyType, ItemType>::EnsureCapacity(int capacity)
+{
+	_map.reserve(capacity);
+	_keys.reserve(capacity);
+	_items.reserve(capacity);
+}
+
 template<typename KeyType, typename ItemType>
 void Pargon::Map<KeyType, ItemType>::Clear()
 {
@@ -0,0 +1,392 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace Pargon
+{
+	enum class PackedEncoding
+	{
+		FrameOfReference,
+		Delta
+	};
+
+	template<typename IntegerType>
+	class PackedList
+	{
+	public:
+		static constexpr int BlockSize = 128;
+
+		PackedList(PackedEncoding encoding = PackedEncoding::FrameOfReference);
+		PackedList(SequenceView<IntegerType> items, PackedEncoding encoding = PackedEncoding::FrameOfReference);
+
+		auto Encoding() const -> PackedEncoding;
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto LastIndex() const -> int;
+		auto PackedSize() const -> int;
+
+		auto Item(int index) const -> IntegerType;
+		auto LowerBound(IntegerType item) const -> int;
+		auto Contains(IntegerType item) const -> bool;
+
+		auto BlockCount() const -> int;
+		auto BlockFirst(int block) const -> IntegerType;
+		auto DecodeBlock(int block, IntegerType* items) const -> int;
+		auto ToList() const -> List<IntegerType>;
+
+		void Add(IntegerType item);
+		void Clear();
+
+	private:
+		static_assert(std::is_integral<IntegerType>::value && sizeof(IntegerType) <= 8, "PackedList requires an integer ItemType of at most 64 bits");
+
+		using UnpackFunction = void(*)(const uint64_t* words, uint64_t* offsets);
+
+		struct Block
+		{
+			IntegerType First;
+			IntegerType Base;
+			int Offset;
+			int Width;
+		};
+
+		PackedEncoding _encoding;
+		List<Block> _blocks;
+		List<uint64_t> _words;
+		List<IntegerType> _pending;
+
+		template<int Width> static void Unpack(const uint64_t* words, uint64_t* offsets);
+		template<std::size_t... Widths> static auto GetUnpacker(int width, std::index_sequence<Widths...>) -> UnpackFunction;
+		static auto Extract(const uint64_t* words, int index, int width) -> uint64_t;
+		static auto Difference(IntegerType left, IntegerType right) -> uint64_t;
+		static auto Offset(IntegerType base, uint64_t offset) -> IntegerType;
+
+		void Flush();
+	};
+}
+
+template<typename IntegerType>
+Pargon::PackedList<IntegerType>::PackedList(PackedEncoding encoding) :
+	_encoding(encoding)
+{
+}
+
+template<typename IntegerType>
+Pargon::PackedList<IntegerType>::PackedList(SequenceView<IntegerType> items, PackedEncoding encoding) :
+	_encoding(encoding)
+{
+	_blocks.EnsureCapacity(items.Count() / BlockSize);
+
+	for (auto item : items)
+		Add(item);
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::Encoding() const -> PackedEncoding
+{
+	return _encoding;
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::IsEmpty() const -> bool
+{
+	return Count() == 0;
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::Count() const -> int
+{
+	return _blocks.Count() * BlockSize + _pending.Count();
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::LastIndex() const -> int
+{
+	return Count() - 1;
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::PackedSize() const -> int
+{
+	return _blocks.Count() * static_cast<int>(sizeof(Block)) + _words.Count() * static_cast<int>(sizeof(uint64_t)) + _pending.Count() * static_cast<int>(sizeof(IntegerType));
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::Item(int index) const -> IntegerType
+{
+	assert(index >= 0 && index < Count());
+
+	auto blockIndex = index / BlockSize;
+
+	if (blockIndex == _blocks.Count())
+		return _pending.Item(index - blockIndex * BlockSize);
+
+	auto& block = _blocks.Item(blockIndex);
+	auto words = _words.begin() + block.Offset;
+	auto position = index - blockIndex * BlockSize;
+
+	if (_encoding == PackedEncoding::FrameOfReference)
+		return Offset(block.Base, Extract(words, position, block.Width));
+
+	auto step = Difference(block.Base, 0);
+	auto sum = uint64_t(0);
+
+	for (auto i = 1; i <= position; i++)
+		sum += Extract(words, i, block.Width) + step;
+
+	return Offset(block.First, sum);
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::LowerBound(IntegerType item) const -> int
+{
+	auto low = 0;
+	auto high = _blocks.Count();
+
+	while (low < high)
+	{
+		auto middle = low + (high - low) / 2;
+
+		if (_blocks.Item(middle).First < item)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	if (low > 0)
+	{
+		IntegerType items[BlockSize];
+		DecodeBlock(low - 1, items);
+
+		auto position = static_cast<int>(std::lower_bound(items, items + BlockSize, item) - items);
+
+		if (position < BlockSize || low < _blocks.Count())
+			return (low - 1) * BlockSize + position;
+	}
+	else if (!_blocks.IsEmpty())
+	{
+		return 0;
+	}
+
+	auto position = static_cast<int>(std::lower_bound(_pending.begin(), _pending.end(), item) - _pending.begin());
+	return _blocks.Count() * BlockSize + position;
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::Contains(IntegerType item) const -> bool
+{
+	auto index = LowerBound(item);
+	return index < Count() && Item(index) == item;
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::BlockCount() const -> int
+{
+	return (Count() + BlockSize - 1) / BlockSize;
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::BlockFirst(int block) const -> IntegerType
+{
+	assert(block >= 0 && block < BlockCount());
+	return block < _blocks.Count() ? _blocks.Item(block).First : _pending.First();
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::DecodeBlock(int blockIndex, IntegerType* items) const -> int
+{
+	assert(blockIndex >= 0 && blockIndex < BlockCount());
+
+	if (blockIndex == _blocks.Count())
+	{
+		std::copy(_pending.begin(), _pending.end(), items);
+		return _pending.Count();
+	}
+
+	auto& block = _blocks.Item(blockIndex);
+
+	uint64_t offsets[BlockSize];
+	GetUnpacker(block.Width, std::make_index_sequence<65>())(_words.begin() + block.Offset, offsets);
+
+	if (_encoding == PackedEncoding::FrameOfReference)
+	{
+		for (auto i = 0; i < BlockSize; i++)
+			items[i] = Offset(block.Base, offsets[i]);
+	}
+	else
+	{
+		auto step = Difference(block.Base, 0);
+		offsets[0] = 0;
+
+		for (auto i = 1; i < BlockSize; i++)
+			offsets[i] += offsets[i - 1] + step;
+
+		for (auto i = 0; i < BlockSize; i++)
+			items[i] = Offset(block.First, offsets[i]);
+	}
+
+	return BlockSize;
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::ToList() const -> List<IntegerType>
+{
+	List<IntegerType> items;
+	items.SetCount(Count());
+
+	for (auto block = 0; block < BlockCount(); block++)
+		DecodeBlock(block, items.begin() + block * BlockSize);
+
+	return items;
+}
+
+template<typename IntegerType>
+void Pargon::PackedList<IntegerType>::Add(IntegerType item)
+{
+	_pending.Add(item);
+
+	if (_pending.Count() == BlockSize)
+		Flush();
+}
+
+template<typename IntegerType>
+void Pargon::PackedList<IntegerType>::Clear()
+{
+	_blocks.Clear();
+	_words.Clear();
+	_pending.Clear();
+}
+
+template<typename IntegerType>
+template<int Width>
+void Pargon::PackedList<IntegerType>::Unpack(const uint64_t* words, uint64_t* offsets)
+{
+	constexpr auto mask = Width == 64 ? ~uint64_t(0) : (uint64_t(1) << Width) - 1;
+
+	for (auto i = 0; i < BlockSize; i++)
+	{
+		if constexpr (Width == 0)
+		{
+			offsets[i] = 0;
+		}
+		else
+		{
+			auto bit = i * Width;
+			auto word = bit / 64;
+			auto shift = bit % 64;
+			auto value = words[word] >> shift;
+
+			if (shift + Width > 64)
+				value |= words[word + 1] << (64 - shift);
+
+			offsets[i] = value & mask;
+		}
+	}
+}
+
+template<typename IntegerType>
+template<std::size_t... Widths>
+auto Pargon::PackedList<IntegerType>::GetUnpacker(int width, std::index_sequence<Widths...>) -> UnpackFunction
+{
+	static constexpr UnpackFunction unpackers[] = { &Unpack<static_cast<int>(Widths)>... };
+	return unpackers[width];
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::Extract(const uint64_t* words, int index, int width) -> uint64_t
+{
+	if (width == 0)
+		return 0;
+
+	auto mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+	auto bit = index * width;
+	auto word = bit / 64;
+	auto shift = bit % 64;
+	auto value = words[word] >> shift;
+
+	if (shift + width > 64)
+		value |= words[word + 1] << (64 - shift);
+
+	return value & mask;
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::Difference(IntegerType left, IntegerType right) -> uint64_t
+{
+	using UnsignedType = std::make_unsigned_t<IntegerType>;
+	return static_cast<UnsignedType>(static_cast<UnsignedType>(left) - static_cast<UnsignedType>(right));
+}
+
+template<typename IntegerType>
+auto Pargon::PackedList<IntegerType>::Offset(IntegerType base, uint64_t offset) -> IntegerType
+{
+	using UnsignedType = std::make_unsigned_t<IntegerType>;
+	return static_cast<IntegerType>(static_cast<UnsignedType>(static_cast<UnsignedType>(base) + static_cast<UnsignedType>(offset)));
+}
+
+template<typename IntegerType>
+void Pargon::PackedList<IntegerType>::Flush()
+{
+	uint64_t offsets[BlockSize];
+	auto first = _pending.First();
+	auto base = first;
+
+	if (_encoding == PackedEncoding::FrameOfReference)
+	{
+		base = *std::min_element(_pending.begin(), _pending.end());
+
+		for (auto i = 0; i < BlockSize; i++)
+			offsets[i] = Difference(_pending.Item(i), base);
+	}
+	else
+	{
+		IntegerType deltas[BlockSize];
+		deltas[0] = 0;
+
+		for (auto i = 1; i < BlockSize; i++)
+			deltas[i] = Offset(_pending.Item(i), Difference(0, _pending.Item(i - 1)));
+
+		base = *std::min_element(deltas + 1, deltas + BlockSize);
+		offsets[0] = 0;
+
+		for (auto i = 1; i < BlockSize; i++)
+			offsets[i] = Difference(deltas[i], base);
+	}
+
+	auto combined = uint64_t(0);
+
+	for (auto offset : offsets)
+		combined |= offset;
+
+	auto width = 0;
+
+	while (width < 64 && (combined >> width) != 0)
+		width++;
+
+	auto start = _words.Count();
+	_words.SetCount(start + BlockSize * width / 64, 0);
+
+	auto words = _words.begin() + start;
+
+	for (auto i = 0; i < BlockSize && width > 0; i++)
+	{
+		auto bit = i * width;
+		auto word = bit / 64;
+		auto shift = bit % 64;
+
+		words[word] |= offsets[i] << shift;
+
+		if (shift + width > 64)
+			words[word + 1] |= offsets[i] >> (64 - shift);
+	}
+
+	_blocks.Add({ first, base, start, width });
+	_pending.Clear();
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Pargon/Containers/Function.h"
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+
+namespace Pargon
+{
+	class ThreadPool
+	{
+	public:
+		static constexpr int MinimumChunkSize = 1024;
+
+		static auto Default() -> ThreadPool&;
+
+		explicit ThreadPool(int threadCount);
+		ThreadPool(const ThreadPool& copy) = delete;
+		~ThreadPool();
+
+		auto operator=(const ThreadPool& copy) -> ThreadPool& = delete;
+
+		auto ThreadCount() const -> int;
+		auto ChunkCount(int itemCount) const -> int;
+		auto ChunkStart(int itemCount, int chunkCount, int chunk) const -> int;
+
+		void Run(int taskCount, FunctionView<void(int)> task);
+
+	private:
+		struct Details;
+		std::unique_ptr<Details> _details;
+	};
+}
+
+template<typename ItemType>
+void Pargon::SequenceView<ItemType>::ParallelForEach(FunctionView<void(const ItemType&)> action) const
+{
+	auto& pool = ThreadPool::Default();
+	auto chunks = pool.ChunkCount(_count);
+
+	pool.Run(chunks, [&](int chunk)
+	{
+		auto start = pool.ChunkStart(_count, chunks, chunk);
+		auto end = pool.ChunkStart(_count, chunks, chunk + 1);
+
+		for (auto& item : GetSubview(start, end - start))
+			action(item);
+	});
+}
+
+template<typename ItemType>
+template<typename ResultType>
+void Pargon::SequenceView<ItemType>::ParallelTransform(SequenceReference<ResultType> results, FunctionView<ResultType(const ItemType&)> transform) const
+{
+	assert(results.Count() == _count);
+
+	auto& pool = ThreadPool::Default();
+	auto chunks = pool.ChunkCount(_count);
+
+	pool.Run(chunks, [&](int chunk)
+	{
+		auto start = pool.ChunkStart(_count, chunks, chunk);
+		auto end = pool.ChunkStart(_count, chunks, chunk + 1);
+
+		for (auto i = start; i < end; i++)
+			results.SetItem(i, transform(_data[i]));
+	});
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::ParallelReduce(ItemType identity, FunctionView<ItemType(const ItemType&, const ItemType&)> reducer) const -> ItemType
+{
+	return ParallelReduce<ItemType>(std::move(identity), reducer, reducer);
+}
+
+template<typename ItemType>
+template<typename ResultType>
+auto Pargon::SequenceView<ItemType>::ParallelReduce(ResultType identity, FunctionView<ResultType(const ResultType&, const ItemType&)> accumulator, FunctionView<ResultType(const ResultType&, const ResultType&)> combiner) const -> ResultType
+{
+	auto& pool = ThreadPool::Default();
+	auto chunks = pool.ChunkCount(_count);
+
+	List<ResultType> results(chunks, identity);
+
+	pool.Run(chunks, [&](int chunk)
+	{
+		auto start = pool.ChunkStart(_count, chunks, chunk);
+		auto end = pool.ChunkStart(_count, chunks, chunk + 1);
+
+		auto& result = results.Item(chunk);
+		for (auto& item : GetSubview(start, end - start))
+			result = accumulator(result, item);
+	});
+
+	auto result = std::move(identity);
+	for (auto& chunkResult : results)
+		result = combiner(result, chunkResult);
+
+	return result;
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::ParallelCount(FunctionView<bool(const ItemType&)> predicate) const -> int
+{
+	auto& pool = ThreadPool::Default();
+	auto chunks = pool.ChunkCount(_count);
+
+	List<int> counts(chunks, 0);
+
+	pool.Run(chunks, [&](int chunk)
+	{
+		auto start = pool.ChunkStart(_count, chunks, chunk);
+		auto end = pool.ChunkStart(_count, chunks, chunk + 1);
+
+		auto count = 0;
+		for (auto& item : GetSubview(start, end - start))
+		{
+			if (predicate(item))
+				count++;
+		}
+
+		counts.SetItem(chunk, count);
+	});
+
+	auto count = 0;
+	for (auto chunkCount : counts)
+		count += chunkCount;
+
+	return count;
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::ParallelForEach(FunctionView<void(ItemType&)> action) const
+{
+	auto& pool = ThreadPool::Default();
+	auto chunks = pool.ChunkCount(_count);
+
+	pool.Run(chunks, [&](int chunk)
+	{
+		auto start = pool.ChunkStart(_count, chunks, chunk);
+		auto end = pool.ChunkStart(_count, chunks, chunk + 1);
+
+		for (auto& item : GetSubreference(start, end - start))
+			action(item);
+	});
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::ParallelSort()
+{
+	ParallelSort([](const ItemType& left, const ItemType& right) { return left < right; });
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::ParallelSort(FunctionView<bool(const ItemType&, const ItemType&)> comparer)
+{
+	auto& pool = ThreadPool::Default();
+	auto chunks = pool.ChunkCount(_count);
+
+	pool.Run(chunks, [&](int chunk)
+	{
+		auto start = pool.ChunkStart(_count, chunks, chunk);
+		auto end = pool.ChunkStart(_count, chunks, chunk + 1);
+
+		GetSubreference(start, end - start).Sort(comparer);
+	});
+
+	for (auto width = 1; width < chunks; width *= 2)
+	{
+		auto merges = (chunks + 2 * width - 1) / (2 * width);
+
+		pool.Run(merges, [&](int merge)
+		{
+			auto first = merge * 2 * width;
+			auto middle = std::min(first + width, chunks);
+			auto last = std::min(first + 2 * width, chunks);
+
+			if (middle < last)
+			{
+				auto start = _data + pool.ChunkStart(_count, chunks, first);
+				auto center = _data + pool.ChunkStart(_count, chunks, middle);
+				auto end = _data + pool.ChunkStart(_count, chunks, last);
+
+				std::inplace_merge(start, center, end, comparer);
+			}
+		});
+	}
+}
@@ -0,0 +1,1061 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType>
+	class PersistentList
+	{
+	public:
+		class Transient
+		{
+		public:
+			auto IsEmpty() const -> bool;
+			auto Count() const -> int;
+			auto Item(int index) const -> const ItemType&;
+
+			void SetItem(int index, ItemType item);
+			void Add(ItemType item);
+			void Append(const PersistentList<ItemType>& other);
+
+			auto ToPersistent() -> PersistentList<ItemType>;
+
+		private:
+			friend class PersistentList<ItemType>;
+
+			PersistentList<ItemType> _list;
+		};
+
+		PersistentList() = default;
+		PersistentList(SequenceView<ItemType> items);
+		PersistentList(const PersistentList<ItemType>& copy);
+		PersistentList(PersistentList<ItemType>&& move);
+		~PersistentList();
+
+		auto operator=(const PersistentList<ItemType>& copy) -> PersistentList<ItemType>&;
+		auto operator=(PersistentList<ItemType>&& move) -> PersistentList<ItemType>&;
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto LastIndex() const -> int;
+
+		auto First() const -> const ItemType&;
+		auto Last() const -> const ItemType&;
+		auto Item(int index) const -> const ItemType&;
+		auto GetView(int index) const -> SequenceView<ItemType>;
+		template<typename ActionType> void ForEachView(ActionType action) const;
+
+		auto SetItem(int index, ItemType item) const -> PersistentList<ItemType>;
+		auto Add(ItemType item) const -> PersistentList<ItemType>;
+		auto Slice(int index, int count) const -> PersistentList<ItemType>;
+		auto Concat(const PersistentList<ItemType>& other) const -> PersistentList<ItemType>;
+
+		auto ToTransient() const -> Transient;
+		auto ToList() const -> List<ItemType>;
+
+	private:
+		static constexpr int Bits = 5;
+		static constexpr int Width = 1 << Bits;
+		static constexpr int Mask = Width - 1;
+
+		struct Node
+		{
+			std::atomic<int> References = 1;
+			int Count = 0;
+		};
+
+		struct Leaf : Node
+		{
+			alignas(ItemType) unsigned char Storage[sizeof(ItemType) * Width];
+
+			auto Items() -> ItemType* { return std::launder(reinterpret_cast<ItemType*>(Storage)); }
+		};
+
+		struct Branch : Node
+		{
+			bool Relaxed = false;
+			int Sizes[Width];
+			Node* Children[Width];
+		};
+
+		Node* _root = nullptr;
+		Node* _tail = nullptr;
+		int _shift = 0;
+		int _count = 0;
+
+		static void Retain(Node* node);
+		static void Release(Node* node, int shift);
+		static auto CopyLeaf(Leaf* leaf, int start, int count) -> Leaf*;
+		static auto MakeUnique(Node*& node, int shift) -> Node*;
+		static auto SubtreeSize(Node* node, int shift) -> int;
+		static auto Locate(Branch* branch, int shift, int& index) -> int;
+		static void MakeRelaxed(Branch* branch, int shift);
+		static void AppendChild(Branch* branch, int shift, Node* child);
+		static auto NewPath(int shift, Node* leaf) -> Node*;
+		static auto AppendLeaf(Branch* branch, int shift, Leaf* leaf) -> bool;
+		static auto TakeNode(Node* node, int shift, int count) -> Node*;
+		static auto DropNode(Node* node, int shift, int count) -> Node*;
+		static auto ConcatNodes(Node* left, int leftShift, Node* right, int rightShift, bool top) -> Branch*;
+		static auto Rebalance(Branch* left, Branch* middle, Branch* right, int shift) -> Branch*;
+		static auto NewBranch(Node* const* children, int count, int shift) -> Branch*;
+		static void AddItems(Node* node, int shift, List<ItemType>& items);
+
+		auto TreeCount() const -> int;
+		void PushTail();
+		void Collapse();
+		void Clear();
+
+		void MutableSetItem(int index, ItemType&& item);
+		void MutableAdd(ItemType&& item);
+		void MutableTake(int count);
+		void MutableDrop(int count);
+		void MutableConcat(const PersistentList<ItemType>& other);
+	};
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Transient::IsEmpty() const -> bool
+{
+	return _list.IsEmpty();
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Transient::Count() const -> int
+{
+	return _list.Count();
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Transient::Item(int index) const -> const ItemType&
+{
+	return _list.Item(index);
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::Transient::SetItem(int index, ItemType item)
+{
+	_list.MutableSetItem(index, std::move(item));
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::Transient::Add(ItemType item)
+{
+	_list.MutableAdd(std::move(item));
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::Transient::Append(const PersistentList<ItemType>& other)
+{
+	_list.MutableConcat(other);
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Transient::ToPersistent() -> PersistentList<ItemType>
+{
+	return std::move(_list);
+}
+
+template<typename ItemType>
+Pargon::PersistentList<ItemType>::PersistentList(SequenceView<ItemType> items)
+{
+	for (auto& item : items)
+		MutableAdd(ItemType(item));
+}
+
+template<typename ItemType>
+Pargon::PersistentList<ItemType>::PersistentList(const PersistentList<ItemType>& copy) :
+	_root(copy._root),
+	_tail(copy._tail),
+	_shift(copy._shift),
+	_count(copy._count)
+{
+	Retain(_root);
+	Retain(_tail);
+}
+
+template<typename ItemType>
+Pargon::PersistentList<ItemType>::PersistentList(PersistentList<ItemType>&& move) :
+	_root(move._root),
+	_tail(move._tail),
+	_shift(move._shift),
+	_count(move._count)
+{
+	move._root = nullptr;
+	move._tail = nullptr;
+	move._shift = 0;
+	move._count = 0;
+}
+
+template<typename ItemType>
+Pargon::PersistentList<ItemType>::~PersistentList()
+{
+	Clear();
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::operator=(const PersistentList<ItemType>& copy) -> PersistentList<ItemType>&
+{
+	if (this != &copy)
+	{
+		Retain(copy._root);
+		Retain(copy._tail);
+		Clear();
+
+		_root = copy._root;
+		_tail = copy._tail;
+		_shift = copy._shift;
+		_count = copy._count;
+	}
+
+	return *this;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::operator=(PersistentList<ItemType>&& move) -> PersistentList<ItemType>&
+{
+	if (this != &move)
+	{
+		Clear();
+
+		_root = move._root;
+		_tail = move._tail;
+		_shift = move._shift;
+		_count = move._count;
+
+		move._root = nullptr;
+		move._tail = nullptr;
+		move._shift = 0;
+		move._count = 0;
+	}
+
+	return *this;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::IsEmpty() const -> bool
+{
+	return _count == 0;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Count() const -> int
+{
+	return _count;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::LastIndex() const -> int
+{
+	return _count - 1;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::First() const -> const ItemType&
+{
+	return Item(0);
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Last() const -> const ItemType&
+{
+	return Item(_count - 1);
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Item(int index) const -> const ItemType&
+{
+	assert(index >= 0 && index < _count);
+
+	auto treeCount = TreeCount();
+
+	if (index >= treeCount)
+		return static_cast<Leaf*>(_tail)->Items()[index - treeCount];
+
+	auto node = _root;
+
+	for (auto shift = _shift; shift > 0; shift -= Bits)
+	{
+		auto branch = static_cast<Branch*>(node);
+		node = branch->Children[Locate(branch, shift, index)];
+	}
+
+	return static_cast<Leaf*>(node)->Items()[index];
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::GetView(int index) const -> SequenceView<ItemType>
+{
+	assert(index >= 0 && index < _count);
+
+	auto treeCount = TreeCount();
+
+	if (index >= treeCount)
+		return SequenceView<ItemType>(static_cast<Leaf*>(_tail)->Items() + index - treeCount, _count - index);
+
+	auto node = _root;
+
+	for (auto shift = _shift; shift > 0; shift -= Bits)
+	{
+		auto branch = static_cast<Branch*>(node);
+		node = branch->Children[Locate(branch, shift, index)];
+	}
+
+	return SequenceView<ItemType>(static_cast<Leaf*>(node)->Items() + index, node->Count - index);
+}
+
+template<typename ItemType>
+template<typename ActionType>
+void Pargon::PersistentList<ItemType>::ForEachView(ActionType action) const
+{
+	for (auto index = 0; index < _count;)
+	{
+		auto view = GetView(index);
+		action(view);
+		index += view.Count();
+	}
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::SetItem(int index, ItemType item) const -> PersistentList<ItemType>
+{
+	auto result = *this;
+	result.MutableSetItem(index, std::move(item));
+	return result;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Add(ItemType item) const -> PersistentList<ItemType>
+{
+	auto result = *this;
+	result.MutableAdd(std::move(item));
+	return result;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Slice(int index, int count) const -> PersistentList<ItemType>
+{
+	assert(index >= 0 && count >= 0 && index + count <= _count);
+
+	auto result = *this;
+	result.MutableTake(index + count);
+	result.MutableDrop(index);
+	return result;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Concat(const PersistentList<ItemType>& other) const -> PersistentList<ItemType>
+{
+	auto result = *this;
+	result.MutableConcat(other);
+	return result;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::ToTransient() const -> Transient
+{
+	Transient transient;
+	transient._list = *this;
+	return transient;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::ToList() const -> List<ItemType>
+{
+	List<ItemType> items;
+	items.EnsureCapacity(_count);
+
+	if (_root != nullptr)
+		AddItems(_root, _shift, items);
+
+	if (_tail != nullptr)
+		AddItems(_tail, 0, items);
+
+	return items;
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::Retain(Node* node)
+{
+	if (node != nullptr)
+		node->References.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::Release(Node* node, int shift)
+{
+	if (node == nullptr || node->References.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+
+	if (shift == 0)
+	{
+		auto leaf = static_cast<Leaf*>(node);
+		std::destroy(leaf->Items(), leaf->Items() + leaf->Count);
+		delete leaf;
+	}
+	else
+	{
+		auto branch = static_cast<Branch*>(node);
+
+		for (auto i = 0; i < branch->Count; i++)
+			Release(branch->Children[i], shift - Bits);
+
+		delete branch;
+	}
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::CopyLeaf(Leaf* leaf, int start, int count) -> Leaf*
+{
+	auto copy = new Leaf;
+	std::uninitialized_copy(leaf->Items() + start, leaf->Items() + start + count, copy->Items());
+	copy->Count = count;
+	return copy;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::MakeUnique(Node*& node, int shift) -> Node*
+{
+	if (node->References.load(std::memory_order_acquire) == 1)
+		return node;
+
+	Node* copy;
+
+	if (shift == 0)
+	{
+		auto leaf = static_cast<Leaf*>(node);
+		copy = CopyLeaf(leaf, 0, leaf->Count);
+	}
+	else
+	{
+		auto branch = static_cast<Branch*>(node);
+		auto branchCopy = new Branch;
+
+		branchCopy->Count = branch->Count;
+		branchCopy->Relaxed = branch->Relaxed;
+
+		for (auto i = 0; i < branch->Count; i++)
+		{
+			branchCopy->Sizes[i] = branch->Sizes[i];
+			branchCopy->Children[i] = branch->Children[i];
+			Retain(branch->Children[i]);
+		}
+
+		copy = branchCopy;
+	}
+
+	Release(node, shift);
+	node = copy;
+	return copy;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::SubtreeSize(Node* node, int shift) -> int
+{
+	if (shift == 0)
+		return node->Count;
+
+	auto branch = static_cast<Branch*>(node);
+
+	if (branch->Relaxed)
+		return branch->Sizes[branch->Count - 1];
+
+	return ((branch->Count - 1) << shift) + SubtreeSize(branch->Children[branch->Count - 1], shift - Bits);
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Locate(Branch* branch, int shift, int& index) -> int
+{
+	if (!branch->Relaxed)
+	{
+		auto slot = (index >> shift) & Mask;
+		index -= slot << shift;
+		return slot;
+	}
+
+	auto slot = index >> shift;
+
+	while (branch->Sizes[slot] <= index)
+		slot++;
+
+	if (slot > 0)
+		index -= branch->Sizes[slot - 1];
+
+	return slot;
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::MakeRelaxed(Branch* branch, int shift)
+{
+	auto total = 0;
+
+	for (auto i = 0; i < branch->Count; i++)
+	{
+		total += SubtreeSize(branch->Children[i], shift - Bits);
+		branch->Sizes[i] = total;
+	}
+
+	branch->Relaxed = true;
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::AppendChild(Branch* branch, int shift, Node* child)
+{
+	assert(branch->Count < Width);
+
+	if (!branch->Relaxed && branch->Count > 0 && SubtreeSize(branch->Children[branch->Count - 1], shift - Bits) != (1 << shift))
+		MakeRelaxed(branch, shift);
+
+	branch->Children[branch->Count] = child;
+
+	if (branch->Relaxed)
+		branch->Sizes[branch->Count] = (branch->Count > 0 ? branch->Sizes[branch->Count - 1] : 0) + SubtreeSize(child, shift - Bits);
+
+	branch->Count++;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::NewPath(int shift, Node* leaf) -> Node*
+{
+	if (shift == 0)
+		return leaf;
+
+	auto branch = new Branch;
+	branch->Children[0] = NewPath(shift - Bits, leaf);
+	branch->Count = 1;
+	return branch;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::AppendLeaf(Branch* branch, int shift, Leaf* leaf) -> bool
+{
+	if (shift > Bits)
+	{
+		auto& last = branch->Children[branch->Count - 1];
+		auto lastBranch = static_cast<Branch*>(MakeUnique(last, shift - Bits));
+
+		if (AppendLeaf(lastBranch, shift - Bits, leaf))
+		{
+			if (branch->Relaxed)
+				branch->Sizes[branch->Count - 1] += leaf->Count;
+
+			return true;
+		}
+	}
+
+	if (branch->Count == Width)
+		return false;
+
+	AppendChild(branch, shift, NewPath(shift - Bits, leaf));
+	return true;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::TakeNode(Node* node, int shift, int count) -> Node*
+{
+	if (shift == 0)
+	{
+		auto leaf = static_cast<Leaf*>(MakeUnique(node, 0));
+		std::destroy(leaf->Items() + count, leaf->Items() + leaf->Count);
+		leaf->Count = count;
+		return leaf;
+	}
+
+	auto branch = static_cast<Branch*>(MakeUnique(node, shift));
+	auto index = count - 1;
+	auto slot = Locate(branch, shift, index);
+
+	for (auto i = slot + 1; i < branch->Count; i++)
+		Release(branch->Children[i], shift - Bits);
+
+	branch->Count = slot + 1;
+	branch->Children[slot] = TakeNode(branch->Children[slot], shift - Bits, index + 1);
+
+	if (branch->Relaxed)
+		branch->Sizes[slot] = (slot > 0 ? branch->Sizes[slot - 1] : 0) + index + 1;
+
+	return branch;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::DropNode(Node* node, int shift, int count) -> Node*
+{
+	if (shift == 0)
+	{
+		auto leaf = static_cast<Leaf*>(node);
+
+		if (leaf->References.load(std::memory_order_acquire) == 1)
+		{
+			auto items = leaf->Items();
+			std::destroy(items, items + count);
+
+			for (auto i = count; i < leaf->Count; i++)
+			{
+				::new(static_cast<void*>(items + i - count)) ItemType(std::move(items[i]));
+				std::destroy_at(items + i);
+			}
+
+			leaf->Count -= count;
+			return leaf;
+		}
+
+		auto copy = CopyLeaf(leaf, count, leaf->Count - count);
+		Release(leaf, 0);
+		return copy;
+	}
+
+	auto branch = static_cast<Branch*>(MakeUnique(node, shift));
+	auto index = count;
+	auto slot = Locate(branch, shift, index);
+
+	for (auto i = 0; i < slot; i++)
+		Release(branch->Children[i], shift - Bits);
+
+	if (index > 0)
+		branch->Children[slot] = DropNode(branch->Children[slot], shift - Bits, index);
+
+	for (auto i = slot; i < branch->Count; i++)
+		branch->Children[i - slot] = branch->Children[i];
+
+	branch->Count -= slot;
+	MakeRelaxed(branch, shift);
+	return branch;
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::ConcatNodes(Node* left, int leftShift, Node* right, int rightShift, bool top) -> Branch*
+{
+	if (leftShift > rightShift)
+	{
+		auto leftBranch = static_cast<Branch*>(left);
+		auto middle = ConcatNodes(leftBranch->Children[leftBranch->Count - 1], leftShift - Bits, right, rightShift, false);
+		return Rebalance(leftBranch, middle, nullptr, leftShift);
+	}
+
+	if (leftShift < rightShift)
+	{
+		auto rightBranch = static_cast<Branch*>(right);
+		auto middle = ConcatNodes(left, leftShift, rightBranch->Children[0], rightShift - Bits, false);
+		return Rebalance(nullptr, middle, rightBranch, rightShift);
+	}
+
+	if (leftShift == 0)
+	{
+		if (top && left->Count + right->Count <= Width)
+		{
+			auto leftLeaf = static_cast<Leaf*>(left);
+			auto rightLeaf = static_cast<Leaf*>(right);
+			auto merged = CopyLeaf(leftLeaf, 0, leftLeaf->Count);
+
+			std::uninitialized_copy(rightLeaf->Items(), rightLeaf->Items() + rightLeaf->Count, merged->Items() + merged->Count);
+			merged->Count += rightLeaf->Count;
+
+			Node* children[] = { merged };
+			return NewBranch(children, 1, Bits);
+		}
+
+		Retain(left);
+		Retain(right);
+
+		Node* children[] = { left, right };
+		return NewBranch(children, 2, Bits);
+	}
+
+	auto leftBranch = static_cast<Branch*>(left);
+	auto rightBranch = static_cast<Branch*>(right);
+	auto middle = ConcatNodes(leftBranch->Children[leftBranch->Count - 1], leftShift - Bits, rightBranch->Children[0], rightShift - Bits, false);
+	return Rebalance(leftBranch, middle, rightBranch, leftShift);
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::Rebalance(Branch* left, Branch* middle, Branch* right, int shift) -> Branch*
+{
+	Node* all[Width * 3];
+	int counts[Width * 3];
+	auto count = 0;
+	auto total = 0;
+
+	if (left != nullptr)
+	{
+		for (auto i = 0; i < left->Count - 1; i++)
+			all[count++] = left->Children[i];
+	}
+
+	for (auto i = 0; i < middle->Count; i++)
+		all[count++] = middle->Children[i];
+
+	if (right != nullptr)
+	{
+		for (auto i = 1; i < right->Count; i++)
+			all[count++] = right->Children[i];
+	}
+
+	for (auto i = 0; i < count; i++)
+	{
+		counts[i] = all[i]->Count;
+		total += counts[i];
+	}
+
+	auto optimal = (total + Width - 1) / Width;
+	auto planned = count;
+	auto index = 0;
+
+	while (planned > optimal + 2)
+	{
+		while (counts[index] > Width - 1)
+			index++;
+
+		auto remaining = counts[index];
+
+		while (remaining > 0)
+		{
+			auto size = remaining + counts[index + 1] < Width ? remaining + counts[index + 1] : Width;
+			remaining = remaining + counts[index + 1] - size;
+			counts[index] = size;
+			index++;
+		}
+
+		for (auto i = index; i < planned - 1; i++)
+			counts[i] = counts[i + 1];
+
+		planned--;
+		index--;
+	}
+
+	Node* rebalanced[Width * 3];
+	auto source = 0;
+	auto offset = 0;
+	auto childShift = shift - Bits;
+
+	for (auto i = 0; i < planned; i++)
+	{
+		if (offset == 0 && all[source]->Count == counts[i])
+		{
+			Retain(all[source]);
+			rebalanced[i] = all[source++];
+			continue;
+		}
+
+		Node* node;
+
+		if (childShift == 0)
+		{
+			auto leaf = new Leaf;
+
+			while (leaf->Count < counts[i])
+			{
+				auto from = static_cast<Leaf*>(all[source]);
+				auto take = counts[i] - leaf->Count < from->Count - offset ? counts[i] - leaf->Count : from->Count - offset;
+
+				std::uninitialized_copy(from->Items() + offset, from->Items() + offset + take, leaf->Items() + leaf->Count);
+				leaf->Count += take;
+				offset += take;
+
+				if (offset == from->Count)
+				{
+					source++;
+					offset = 0;
+				}
+			}
+
+			node = leaf;
+		}
+		else
+		{
+			auto branch = new Branch;
+
+			while (branch->Count < counts[i])
+			{
+				auto from = static_cast<Branch*>(all[source]);
+				auto take = counts[i] - branch->Count < from->Count - offset ? counts[i] - branch->Count : from->Count - offset;
+
+				for (auto j = 0; j < take; j++)
+				{
+					Retain(from->Children[offset + j]);
+					branch->Children[branch->Count++] = from->Children[offset + j];
+				}
+
+				offset += take;
+
+				if (offset == from->Count)
+				{
+					source++;
+					offset = 0;
+				}
+			}
+
+			MakeRelaxed(branch, childShift);
+			node = branch;
+		}
+
+		rebalanced[i] = node;
+	}
+
+	Release(middle, shift);
+
+	if (planned <= Width)
+	{
+		Node* children[] = { NewBranch(rebalanced, planned, shift) };
+		return NewBranch(children, 1, shift + Bits);
+	}
+
+	Node* children[] = { NewBranch(rebalanced, Width, shift), NewBranch(rebalanced + Width, planned - Width, shift) };
+	return NewBranch(children, 2, shift + Bits);
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::NewBranch(Node* const* children, int count, int shift) -> Branch*
+{
+	auto branch = new Branch;
+
+	for (auto i = 0; i < count; i++)
+		branch->Children[i] = children[i];
+
+	branch->Count = count;
+	MakeRelaxed(branch, shift);
+	return branch;
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::AddItems(Node* node, int shift, List<ItemType>& items)
+{
+	if (shift == 0)
+	{
+		auto leaf = static_cast<Leaf*>(node);
+
+		for (auto i = 0; i < leaf->Count; i++)
+			items.Add(leaf->Items()[i]);
+	}
+	else
+	{
+		auto branch = static_cast<Branch*>(node);
+
+		for (auto i = 0; i < branch->Count; i++)
+			AddItems(branch->Children[i], shift - Bits, items);
+	}
+}
+
+template<typename ItemType>
+auto Pargon::PersistentList<ItemType>::TreeCount() const -> int
+{
+	return _count - (_tail != nullptr ? _tail->Count : 0);
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::PushTail()
+{
+	auto leaf = _tail;
+	_tail = nullptr;
+
+	if (leaf == nullptr)
+		return;
+
+	if (leaf->Count == 0)
+	{
+		Release(leaf, 0);
+		return;
+	}
+
+	if (_root == nullptr)
+	{
+		_root = leaf;
+		_shift = 0;
+		return;
+	}
+
+	if (_shift == 0)
+	{
+		auto branch = new Branch;
+		AppendChild(branch, Bits, _root);
+		AppendChild(branch, Bits, leaf);
+
+		_root = branch;
+		_shift = Bits;
+		return;
+	}
+
+	auto root = static_cast<Branch*>(MakeUnique(_root, _shift));
+
+	if (!AppendLeaf(root, _shift, static_cast<Leaf*>(leaf)))
+	{
+		auto branch = new Branch;
+		AppendChild(branch, _shift + Bits, root);
+		AppendChild(branch, _shift + Bits, NewPath(_shift, leaf));
+
+		_root = branch;
+		_shift += Bits;
+	}
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::Collapse()
+{
+	while (_shift > 0 && static_cast<Branch*>(_root)->Count == 1)
+	{
+		auto child = static_cast<Branch*>(_root)->Children[0];
+
+		Retain(child);
+		Release(_root, _shift);
+
+		_root = child;
+		_shift -= Bits;
+	}
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::Clear()
+{
+	Release(_root, _shift);
+	Release(_tail, 0);
+
+	_root = nullptr;
+	_tail = nullptr;
+	_shift = 0;
+	_count = 0;
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::MutableSetItem(int index, ItemType&& item)
+{
+	assert(index >= 0 && index < _count);
+
+	auto treeCount = TreeCount();
+
+	if (index >= treeCount)
+	{
+		auto tail = static_cast<Leaf*>(MakeUnique(_tail, 0));
+		tail->Items()[index - treeCount] = std::move(item);
+		return;
+	}
+
+	auto slot = &_root;
+
+	for (auto shift = _shift; shift > 0; shift -= Bits)
+	{
+		auto branch = static_cast<Branch*>(MakeUnique(*slot, shift));
+		slot = &branch->Children[Locate(branch, shift, index)];
+	}
+
+	auto leaf = static_cast<Leaf*>(MakeUnique(*slot, 0));
+	leaf->Items()[index] = std::move(item);
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::MutableAdd(ItemType&& item)
+{
+	if (_tail != nullptr && _tail->Count == Width)
+		PushTail();
+
+	if (_tail == nullptr)
+		_tail = new Leaf;
+	else
+		MakeUnique(_tail, 0);
+
+	::new(static_cast<void*>(static_cast<Leaf*>(_tail)->Items() + _tail->Count)) ItemType(std::move(item));
+	_tail->Count++;
+	_count++;
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::MutableTake(int count)
+{
+	if (count >= _count)
+		return;
+
+	if (count == 0)
+	{
+		Clear();
+		return;
+	}
+
+	auto treeCount = TreeCount();
+
+	if (count >= treeCount)
+	{
+		_tail = TakeNode(_tail, 0, count - treeCount);
+	}
+	else
+	{
+		Release(_tail, 0);
+		_tail = nullptr;
+
+		_root = TakeNode(_root, _shift, count);
+		Collapse();
+	}
+
+	_count = count;
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::MutableDrop(int count)
+{
+	if (count <= 0)
+		return;
+
+	if (count >= _count)
+	{
+		Clear();
+		return;
+	}
+
+	auto treeCount = TreeCount();
+
+	if (count >= treeCount)
+	{
+		Release(_root, _shift);
+		_root = nullptr;
+		_shift = 0;
+
+		if (count > treeCount)
+			_tail = DropNode(_tail, 0, count - treeCount);
+	}
+	else
+	{
+		_root = DropNode(_root, _shift, count);
+		Collapse();
+	}
+
+	_count -= count;
+}
+
+template<typename ItemType>
+void Pargon::PersistentList<ItemType>::MutableConcat(const PersistentList<ItemType>& other)
+{
+	if (other._count == 0)
+		return;
+
+	if (_count == 0)
+	{
+		*this = other;
+		return;
+	}
+
+	if (other._root == nullptr)
+	{
+		for (auto i = 0; i < other._tail->Count; i++)
+			MutableAdd(ItemType(static_cast<Leaf*>(other._tail)->Items()[i]));
+
+		return;
+	}
+
+	PushTail();
+
+	auto root = ConcatNodes(_root, _shift, other._root, other._shift, true);
+	Release(_root, _shift);
+
+	_shift = (_shift > other._shift ? _shift : other._shift) + Bits;
+	_root = root;
+	Collapse();
+
+	_tail = other._tail;
+	Retain(_tail);
+
+	_count += other._count;
+}
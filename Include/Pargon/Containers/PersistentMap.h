@@ -0,0 +1,544 @@
+#pragma once
+
+#include "Pargon/Containers/Hash.h"
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Map.h"
+
+#include <atomic>
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename KeyType, typename ItemType>
+	class PersistentMap
+	{
+	public:
+		class Transient
+		{
+		public:
+			auto IsEmpty() const -> bool;
+			auto Count() const -> int;
+			auto Contains(const KeyType& key) const -> bool;
+			auto ItemWithKey(const KeyType& key) const -> const ItemType&;
+
+			void AddOrSet(const KeyType& key, ItemType item);
+			void RemoveWithKey(const KeyType& key);
+
+			auto ToPersistent() -> PersistentMap<KeyType, ItemType>;
+
+		private:
+			friend class PersistentMap<KeyType, ItemType>;
+
+			PersistentMap<KeyType, ItemType> _map;
+		};
+
+		PersistentMap() = default;
+		PersistentMap(const Map<KeyType, ItemType>& map);
+		PersistentMap(const PersistentMap<KeyType, ItemType>& copy);
+		PersistentMap(PersistentMap<KeyType, ItemType>&& move);
+		~PersistentMap();
+
+		auto operator=(const PersistentMap<KeyType, ItemType>& copy) -> PersistentMap<KeyType, ItemType>&;
+		auto operator=(PersistentMap<KeyType, ItemType>&& move) -> PersistentMap<KeyType, ItemType>&;
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto Contains(const KeyType& key) const -> bool;
+		auto ItemWithKey(const KeyType& key) const -> const ItemType&;
+		auto FindItem(const KeyType& key) const -> const ItemType*;
+		template<typename ActionType> void ForEach(ActionType action) const;
+
+		auto AddOrSet(const KeyType& key, ItemType item) const -> PersistentMap<KeyType, ItemType>;
+		auto RemoveWithKey(const KeyType& key) const -> PersistentMap<KeyType, ItemType>;
+
+		auto ToTransient() const -> Transient;
+		auto ToMap() const -> Map<KeyType, ItemType>;
+
+	private:
+		static_assert(IsHashable<KeyType>, "KeyType is not hashable and therefore cannot be used as the key type for a PersistentMap");
+
+		static constexpr int Bits = 5;
+		static constexpr int Mask = (1 << Bits) - 1;
+		static constexpr int HashBits = static_cast<int>(sizeof(std::size_t) * 8);
+
+		struct Entry
+		{
+			std::size_t Hash;
+			KeyType Key;
+			ItemType Item;
+		};
+
+		struct Node
+		{
+			std::atomic<int> References = 1;
+			unsigned int EntryMap = 0;
+			unsigned int ChildMap = 0;
+			List<Entry> Entries;
+			List<Node*> Children;
+		};
+
+		Node* _root = nullptr;
+		int _count = 0;
+
+		static auto Slot(std::size_t hash, int shift) -> unsigned int;
+		static auto Position(unsigned int map, unsigned int bit) -> int;
+
+		static void Retain(Node* node);
+		static void Release(Node* node);
+		static auto MakeUnique(Node*& node) -> Node*;
+		static auto Merge(Entry&& first, Entry&& second, int shift) -> Node*;
+		static auto Set(Node*& node, int shift, Entry&& entry) -> bool;
+		static void Remove(Node*& node, int shift, std::size_t hash, const KeyType& key);
+		static void AddEntries(const Node* node, Map<KeyType, ItemType>& map);
+		template<typename ActionType> static void VisitEntries(const Node* node, ActionType& action);
+
+		auto Find(const KeyType& key) const -> const Entry*;
+		void Clear();
+
+		void MutableAddOrSet(const KeyType& key, ItemType&& item);
+		void MutableRemove(const KeyType& key);
+	};
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Transient::IsEmpty() const -> bool
+{
+	return _map.IsEmpty();
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Transient::Count() const -> int
+{
+	return _map.Count();
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Transient::Contains(const KeyType& key) const -> bool
+{
+	return _map.Contains(key);
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Transient::ItemWithKey(const KeyType& key) const -> const ItemType&
+{
+	return _map.ItemWithKey(key);
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::Transient::AddOrSet(const KeyType& key, ItemType item)
+{
+	_map.MutableAddOrSet(key, std::move(item));
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::Transient::RemoveWithKey(const KeyType& key)
+{
+	_map.MutableRemove(key);
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Transient::ToPersistent() -> PersistentMap<KeyType, ItemType>
+{
+	return std::move(_map);
+}
+
+template<typename KeyType, typename ItemType>
+Pargon::PersistentMap<KeyType, ItemType>::PersistentMap(const Map<KeyType, ItemType>& map)
+{
+	for (auto i = 0; i < map.Count(); i++)
+		MutableAddOrSet(map.GetKey(i), ItemType(map.ItemAtIndex(i)));
+}
+
+template<typename KeyType, typename ItemType>
+Pargon::PersistentMap<KeyType, ItemType>::PersistentMap(const PersistentMap<KeyType, ItemType>& copy) :
+	_root(copy._root),
+	_count(copy._count)
+{
+	Retain(_root);
+}
+
+template<typename KeyType, typename ItemType>
+Pargon::PersistentMap<KeyType, ItemType>::PersistentMap(PersistentMap<KeyType, ItemType>&& move) :
+	_root(move._root),
+	_count(move._count)
+{
+	move._root = nullptr;
+	move._count = 0;
+}
+
+template<typename KeyType, typename ItemType>
+Pargon::PersistentMap<KeyType, ItemType>::~PersistentMap()
+{
+	Clear();
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::operator=(const PersistentMap<KeyType, ItemType>& copy) -> PersistentMap<KeyType, ItemType>&
+{
+	if (this != &copy)
+	{
+		Retain(copy._root);
+		Clear();
+
+		_root = copy._root;
+		_count = copy._count;
+	}
+
+	return *this;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::operator=(PersistentMap<KeyType, ItemType>&& move) -> PersistentMap<KeyType, ItemType>&
+{
+	if (this != &move)
+	{
+		Clear();
+
+		_root = move._root;
+		_count = move._count;
+
+		move._root = nullptr;
+		move._count = 0;
+	}
+
+	return *this;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::IsEmpty() const -> bool
+{
+	return _count == 0;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Count() const -> int
+{
+	return _count;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Contains(const KeyType& key) const -> bool
+{
+	return Find(key) != nullptr;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::ItemWithKey(const KeyType& key) const -> const ItemType&
+{
+	auto entry = Find(key);
+	assert(entry != nullptr);
+	return entry->Item;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::FindItem(const KeyType& key) const -> const ItemType*
+{
+	auto entry = Find(key);
+	return entry != nullptr ? &entry->Item : nullptr;
+}
+
+template<typename KeyType, typename ItemType>
+template<typename ActionType>
+void Pargon::PersistentMap<KeyType, ItemType>::ForEach(ActionType action) const
+{
+	if (_root != nullptr)
+		VisitEntries(_root, action);
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::AddOrSet(const KeyType& key, ItemType item) const -> PersistentMap<KeyType, ItemType>
+{
+	auto result = *this;
+	result.MutableAddOrSet(key, std::move(item));
+	return result;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::RemoveWithKey(const KeyType& key) const -> PersistentMap<KeyType, ItemType>
+{
+	auto result = *this;
+	result.MutableRemove(key);
+	return result;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::ToTransient() const -> Transient
+{
+	Transient transient;
+	transient._map = *this;
+	return transient;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::ToMap() const -> Map<KeyType, ItemType>
+{
+	Map<KeyType, ItemType> map;
+
+	if (_root != nullptr)
+		AddEntries(_root, map);
+
+	return map;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Slot(std::size_t hash, int shift) -> unsigned int
+{
+	return 1u << ((hash >> shift) & Mask);
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Position(unsigned int map, unsigned int bit) -> int
+{
+	return static_cast<int>(std::bitset<32>(map & (bit - 1)).count());
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::Retain(Node* node)
+{
+	if (node != nullptr)
+		node->References.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::Release(Node* node)
+{
+	if (node == nullptr || node->References.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+
+	for (auto child : node->Children)
+		Release(child);
+
+	delete node;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::MakeUnique(Node*& node) -> Node*
+{
+	if (node->References.load(std::memory_order_acquire) == 1)
+		return node;
+
+	auto copy = new Node;
+	copy->EntryMap = node->EntryMap;
+	copy->ChildMap = node->ChildMap;
+	copy->Entries = node->Entries;
+	copy->Children = node->Children;
+
+	for (auto child : copy->Children)
+		Retain(child);
+
+	Release(node);
+	node = copy;
+	return copy;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Merge(Entry&& first, Entry&& second, int shift) -> Node*
+{
+	auto node = new Node;
+
+	if (shift >= HashBits)
+	{
+		node->Entries.Add(std::move(first));
+		node->Entries.Add(std::move(second));
+		return node;
+	}
+
+	auto firstBit = Slot(first.Hash, shift);
+	auto secondBit = Slot(second.Hash, shift);
+
+	if (firstBit == secondBit)
+	{
+		node->ChildMap = firstBit;
+		node->Children.Add(Merge(std::move(first), std::move(second), shift + Bits));
+	}
+	else
+	{
+		node->EntryMap = firstBit | secondBit;
+		node->Entries.Add(firstBit < secondBit ? std::move(first) : std::move(second));
+		node->Entries.Add(firstBit < secondBit ? std::move(second) : std::move(first));
+	}
+
+	return node;
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Set(Node*& node, int shift, Entry&& entry) -> bool
+{
+	auto unique = MakeUnique(node);
+
+	if (shift >= HashBits)
+	{
+		for (auto& existing : unique->Entries)
+		{
+			if (existing.Key == entry.Key)
+			{
+				existing.Item = std::move(entry.Item);
+				return false;
+			}
+		}
+
+		unique->Entries.Add(std::move(entry));
+		return true;
+	}
+
+	auto bit = Slot(entry.Hash, shift);
+
+	if (unique->EntryMap & bit)
+	{
+		auto index = Position(unique->EntryMap, bit);
+		auto& existing = unique->Entries.Item(index);
+
+		if (existing.Hash == entry.Hash && existing.Key == entry.Key)
+		{
+			existing.Item = std::move(entry.Item);
+			return false;
+		}
+
+		auto child = Merge(std::move(existing), std::move(entry), shift + Bits);
+
+		unique->Entries.RemoveAt(index);
+		unique->EntryMap ^= bit;
+		unique->ChildMap |= bit;
+		unique->Children.Insert(child, Position(unique->ChildMap, bit));
+		return true;
+	}
+
+	if (unique->ChildMap & bit)
+		return Set(unique->Children.Item(Position(unique->ChildMap, bit)), shift + Bits, std::move(entry));
+
+	unique->EntryMap |= bit;
+	unique->Entries.Insert(std::move(entry), Position(unique->EntryMap, bit));
+	return true;
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::Remove(Node*& node, int shift, std::size_t hash, const KeyType& key)
+{
+	auto unique = MakeUnique(node);
+
+	if (shift >= HashBits)
+	{
+		for (auto i = 0; i < unique->Entries.Count(); i++)
+		{
+			if (unique->Entries.Item(i).Key == key)
+			{
+				unique->Entries.RemoveAt(i);
+				return;
+			}
+		}
+
+		return;
+	}
+
+	auto bit = Slot(hash, shift);
+
+	if (unique->EntryMap & bit)
+	{
+		unique->Entries.RemoveAt(Position(unique->EntryMap, bit));
+		unique->EntryMap ^= bit;
+		return;
+	}
+
+	auto index = Position(unique->ChildMap, bit);
+	auto& child = unique->Children.Item(index);
+
+	Remove(child, shift + Bits, hash, key);
+
+	if (child->Children.IsEmpty() && child->Entries.Count() == 1)
+	{
+		auto entry = std::move(child->Entries.First());
+
+		Release(child);
+		unique->Children.RemoveAt(index);
+		unique->ChildMap ^= bit;
+		unique->EntryMap |= bit;
+		unique->Entries.Insert(std::move(entry), Position(unique->EntryMap, bit));
+	}
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::AddEntries(const Node* node, Map<KeyType, ItemType>& map)
+{
+	for (auto& entry : node->Entries)
+		map.AddOrSet(entry.Key, entry.Item);
+
+	for (auto child : node->Children)
+		AddEntries(child, map);
+}
+
+template<typename KeyType, typename ItemType>
+template<typename ActionType>
+void Pargon::PersistentMap<KeyType, ItemType>::VisitEntries(const Node* node, ActionType& action)
+{
+	for (auto& entry : node->Entries)
+		action(entry.Key, entry.Item);
+
+	for (auto child : node->Children)
+		VisitEntries(child, action);
+}
+
+template<typename KeyType, typename ItemType>
+auto Pargon::PersistentMap<KeyType, ItemType>::Find(const KeyType& key) const -> const Entry*
+{
+	auto hash = static_cast<std::size_t>(Hasher<KeyType>{}(key));
+	auto node = static_cast<const Node*>(_root);
+
+	for (auto shift = 0; node != nullptr; shift += Bits)
+	{
+		if (shift >= HashBits)
+		{
+			for (auto& entry : node->Entries)
+			{
+				if (entry.Key == key)
+					return &entry;
+			}
+
+			return nullptr;
+		}
+
+		auto bit = Slot(hash, shift);
+
+		if (node->EntryMap & bit)
+		{
+			auto& entry = node->Entries.Item(Position(node->EntryMap, bit));
+			return entry.Hash == hash && entry.Key == key ? &entry : nullptr;
+		}
+
+		node = node->ChildMap & bit ? node->Children.Item(Position(node->ChildMap, bit)) : nullptr;
+	}
+
+	return nullptr;
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::Clear()
+{
+	Release(_root);
+	_root = nullptr;
+	_count = 0;
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::MutableAddOrSet(const KeyType& key, ItemType&& item)
+{
+	if (_root == nullptr)
+		_root = new Node;
+
+	if (Set(_root, 0, { Hasher<KeyType>{}(key), key, std::move(item) }))
+		_count++;
+}
+
+template<typename KeyType, typename ItemType>
+void Pargon::PersistentMap<KeyType, ItemType>::MutableRemove(const KeyType& key)
+{
+	if (Find(key) == nullptr)
+		return;
+
+	Remove(_root, 0, Hasher<KeyType>{}(key), key);
+
+	if (--_count == 0)
+		Clear();
+}
@@ -0,0 +1,478 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Map.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType>
+	struct PipelineSource
+	{
+		ItemType* Data;
+		int Count;
+
+		auto Bound() const -> int;
+		template<typename SinkType> void Run(SinkType& sink) const;
+	};
+
+	template<typename StageType> struct IsPipelineSource : std::false_type {};
+	template<typename ItemType> struct IsPipelineSource<PipelineSource<ItemType>> : std::true_type {};
+
+	template<typename SourceType, typename PredicateType>
+	struct PipelineFilter
+	{
+		SourceType Source;
+		PredicateType Predicate;
+
+		auto Bound() const -> int;
+		template<typename SinkType> void Run(SinkType& sink) const;
+	};
+
+	template<typename SourceType, typename TransformType>
+	struct PipelineTransform
+	{
+		SourceType Source;
+		TransformType Transform;
+
+		auto Bound() const -> int;
+		template<typename SinkType> void Run(SinkType& sink) const;
+	};
+
+	template<typename SourceType>
+	struct PipelineTake
+	{
+		SourceType Source;
+		int Count;
+
+		auto Bound() const -> int;
+		template<typename SinkType> void Run(SinkType& sink) const;
+	};
+
+	template<typename SourceType>
+	struct PipelineSkip
+	{
+		SourceType Source;
+		int Count;
+
+		auto Bound() const -> int;
+		template<typename SinkType> void Run(SinkType& sink) const;
+	};
+
+	template<typename ItemType, typename SourceType, typename OtherType>
+	struct PipelineZip
+	{
+		SourceType Source;
+		SequenceView<OtherType> Other;
+
+		auto Bound() const -> int;
+		template<typename SinkType> void Run(SinkType& sink) const;
+	};
+
+	template<typename ItemType, typename SourceType>
+	struct PipelineEnumerate
+	{
+		SourceType Source;
+
+		auto Bound() const -> int;
+		template<typename SinkType> void Run(SinkType& sink) const;
+	};
+
+	template<typename ValueType, typename SourceType>
+	struct PipelineChunk
+	{
+		using ChunkType = std::conditional_t<IsPipelineSource<SourceType>::value, SequenceView<ValueType>, List<ValueType>>;
+
+		SourceType Source;
+		int Size;
+
+		auto Bound() const -> int;
+		template<typename SinkType> void Run(SinkType& sink) const;
+	};
+
+	template<typename ItemType, typename StageType>
+	class Pipeline
+	{
+	public:
+		using ValueType = std::remove_cv_t<std::remove_reference_t<ItemType>>;
+
+		Pipeline(StageType stage);
+
+		auto Bound() const -> int;
+
+		template<typename PredicateType> auto Filter(PredicateType predicate) const -> Pipeline<ItemType, PipelineFilter<StageType, PredicateType>>;
+		template<typename TransformType> auto Transform(TransformType transform) const -> Pipeline<std::invoke_result_t<const TransformType&, ItemType>, PipelineTransform<StageType, TransformType>>;
+		auto Take(int count) const -> Pipeline<ItemType, PipelineTake<StageType>>;
+		auto Skip(int count) const -> Pipeline<ItemType, PipelineSkip<StageType>>;
+		template<typename OtherType> auto Zip(SequenceView<OtherType> other) const -> Pipeline<std::pair<ItemType, const OtherType&>, PipelineZip<ItemType, StageType, OtherType>>;
+		auto Enumerate() const -> Pipeline<std::pair<int, ItemType>, PipelineEnumerate<ItemType, StageType>>;
+		auto Chunk(int size) const -> Pipeline<typename PipelineChunk<ValueType, StageType>::ChunkType, PipelineChunk<ValueType, StageType>>;
+
+		template<typename ActionType> void ForEach(ActionType action) const;
+		template<typename ResultType, typename AccumulatorType> auto Reduce(ResultType identity, AccumulatorType accumulator) const -> ResultType;
+		auto Count() const -> int;
+		auto ToList() const -> List<ValueType>;
+		template<typename KeySelectorType> auto ToMap(KeySelectorType keySelector) const -> Map<std::decay_t<std::invoke_result_t<const KeySelectorType&, const ValueType&>>, ValueType>;
+		template<typename KeySelectorType, typename ItemSelectorType> auto ToMap(KeySelectorType keySelector, ItemSelectorType itemSelector) const -> Map<std::decay_t<std::invoke_result_t<const KeySelectorType&, const ValueType&>>, std::decay_t<std::invoke_result_t<const ItemSelectorType&, const ValueType&>>>;
+
+	private:
+		StageType _stage;
+	};
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::Pipe() const -> Pipeline<const ItemType&, PipelineSource<const ItemType>>
+{
+	return PipelineSource<const ItemType>{ _data, _count };
+}
+
+template<typename ItemType>
+auto Pargon::SequenceReference<ItemType>::Pipe() const -> Pipeline<ItemType&, PipelineSource<ItemType>>
+{
+	return PipelineSource<ItemType>{ _data, _count };
+}
+
+template<typename ItemType>
+auto Pargon::PipelineSource<ItemType>::Bound() const -> int
+{
+	return Count;
+}
+
+template<typename ItemType>
+template<typename SinkType>
+void Pargon::PipelineSource<ItemType>::Run(SinkType& sink) const
+{
+	for (auto i = 0; i < Count; i++)
+	{
+		if (!sink(Data[i]))
+			return;
+	}
+}
+
+template<typename SourceType, typename PredicateType>
+auto Pargon::PipelineFilter<SourceType, PredicateType>::Bound() const -> int
+{
+	return Source.Bound();
+}
+
+template<typename SourceType, typename PredicateType>
+template<typename SinkType>
+void Pargon::PipelineFilter<SourceType, PredicateType>::Run(SinkType& sink) const
+{
+	auto filter = [this, &sink](auto&& item) -> bool
+	{
+		return !Predicate(item) || sink(std::forward<decltype(item)>(item));
+	};
+
+	Source.Run(filter);
+}
+
+template<typename SourceType, typename TransformType>
+auto Pargon::PipelineTransform<SourceType, TransformType>::Bound() const -> int
+{
+	return Source.Bound();
+}
+
+template<typename SourceType, typename TransformType>
+template<typename SinkType>
+void Pargon::PipelineTransform<SourceType, TransformType>::Run(SinkType& sink) const
+{
+	auto transform = [this, &sink](auto&& item) -> bool
+	{
+		return sink(Transform(std::forward<decltype(item)>(item)));
+	};
+
+	Source.Run(transform);
+}
+
+template<typename SourceType>
+auto Pargon::PipelineTake<SourceType>::Bound() const -> int
+{
+	return std::min(Source.Bound(), Count);
+}
+
+template<typename SourceType>
+template<typename SinkType>
+void Pargon::PipelineTake<SourceType>::Run(SinkType& sink) const
+{
+	auto remaining = Count;
+
+	auto take = [&remaining, &sink](auto&& item) -> bool
+	{
+		return sink(std::forward<decltype(item)>(item)) && --remaining > 0;
+	};
+
+	if (remaining > 0)
+		Source.Run(take);
+}
+
+template<typename SourceType>
+auto Pargon::PipelineSkip<SourceType>::Bound() const -> int
+{
+	return std::max(Source.Bound() - Count, 0);
+}
+
+template<typename SourceType>
+template<typename SinkType>
+void Pargon::PipelineSkip<SourceType>::Run(SinkType& sink) const
+{
+	auto remaining = Count;
+
+	auto skip = [&remaining, &sink](auto&& item) -> bool
+	{
+		if (remaining > 0)
+		{
+			remaining--;
+			return true;
+		}
+
+		return sink(std::forward<decltype(item)>(item));
+	};
+
+	Source.Run(skip);
+}
+
+template<typename ItemType, typename SourceType, typename OtherType>
+auto Pargon::PipelineZip<ItemType, SourceType, OtherType>::Bound() const -> int
+{
+	return std::min(Source.Bound(), Other.Count());
+}
+
+template<typename ItemType, typename SourceType, typename OtherType>
+template<typename SinkType>
+void Pargon::PipelineZip<ItemType, SourceType, OtherType>::Run(SinkType& sink) const
+{
+	auto index = 0;
+
+	auto zip = [this, &index, &sink](auto&& item) -> bool
+	{
+		if (index == Other.Count())
+			return false;
+
+		return sink(std::pair<ItemType, const OtherType&>(std::forward<decltype(item)>(item), Other.Item(index++)));
+	};
+
+	Source.Run(zip);
+}
+
+template<typename ItemType, typename SourceType>
+auto Pargon::PipelineEnumerate<ItemType, SourceType>::Bound() const -> int
+{
+	return Source.Bound();
+}
+
+template<typename ItemType, typename SourceType>
+template<typename SinkType>
+void Pargon::PipelineEnumerate<ItemType, SourceType>::Run(SinkType& sink) const
+{
+	auto index = 0;
+
+	auto enumerate = [&index, &sink](auto&& item) -> bool
+	{
+		return sink(std::pair<int, ItemType>(index++, std::forward<decltype(item)>(item)));
+	};
+
+	Source.Run(enumerate);
+}
+
+template<typename ValueType, typename SourceType>
+auto Pargon::PipelineChunk<ValueType, SourceType>::Bound() const -> int
+{
+	return (Source.Bound() + Size - 1) / Size;
+}
+
+template<typename ValueType, typename SourceType>
+template<typename SinkType>
+void Pargon::PipelineChunk<ValueType, SourceType>::Run(SinkType& sink) const
+{
+	assert(Size > 0);
+
+	if constexpr (IsPipelineSource<SourceType>::value)
+	{
+		for (auto start = 0; start < Source.Count; start += Size)
+		{
+			if (!sink(SequenceView<ValueType>(Source.Data + start, std::min(Size, Source.Count - start))))
+				return;
+		}
+	}
+	else
+	{
+		List<ValueType> buffer;
+		buffer.EnsureCapacity(Size);
+
+		auto stopped = false;
+
+		auto chunk = [this, &buffer, &stopped, &sink](auto&& item) -> bool
+		{
+			buffer.Add(ValueType(std::forward<decltype(item)>(item)));
+
+			if (buffer.Count() < Size)
+				return true;
+
+			stopped = !sink(std::move(buffer));
+			buffer.Clear();
+			buffer.EnsureCapacity(Size);
+			return !stopped;
+		};
+
+		Source.Run(chunk);
+
+		if (!stopped && !buffer.IsEmpty())
+			sink(std::move(buffer));
+	}
+}
+
+template<typename ItemType, typename StageType>
+Pargon::Pipeline<ItemType, StageType>::Pipeline(StageType stage) :
+	_stage(std::move(stage))
+{
+}
+
+template<typename ItemType, typename StageType>
+auto Pargon::Pipeline<ItemType, StageType>::Bound() const -> int
+{
+	return _stage.Bound();
+}
+
+template<typename ItemType, typename StageType>
+template<typename PredicateType>
+auto Pargon::Pipeline<ItemType, StageType>::Filter(PredicateType predicate) const -> Pipeline<ItemType, PipelineFilter<StageType, PredicateType>>
+{
+	return PipelineFilter<StageType, PredicateType>{ _stage, std::move(predicate) };
+}
+
+template<typename ItemType, typename StageType>
+template<typename TransformType>
+auto Pargon::Pipeline<ItemType, StageType>::Transform(TransformType transform) const -> Pipeline<std::invoke_result_t<const TransformType&, ItemType>, PipelineTransform<StageType, TransformType>>
+{
+	return PipelineTransform<StageType, TransformType>{ _stage, std::move(transform) };
+}
+
+template<typename ItemType, typename StageType>
+auto Pargon::Pipeline<ItemType, StageType>::Take(int count) const -> Pipeline<ItemType, PipelineTake<StageType>>
+{
+	return PipelineTake<StageType>{ _stage, count };
+}
+
+template<typename ItemType, typename StageType>
+auto Pargon::Pipeline<ItemType, StageType>::Skip(int count) const -> Pipeline<ItemType, PipelineSkip<StageType>>
+{
+	return PipelineSkip<StageType>{ _stage, count };
+}
+
+template<typename ItemType, typename StageType>
+template<typename OtherType>
+auto Pargon::Pipeline<ItemType, StageType>::Zip(SequenceView<OtherType> other) const -> Pipeline<std::pair<ItemType, const OtherType&>, PipelineZip<ItemType, StageType, OtherType>>
+{
+	return PipelineZip<ItemType, StageType, OtherType>{ _stage, other };
+}
+
+template<typename ItemType, typename StageType>
+auto Pargon::Pipeline<ItemType, StageType>::Enumerate() const -> Pipeline<std::pair<int, ItemType>, PipelineEnumerate<ItemType, StageType>>
+{
+	return PipelineEnumerate<ItemType, StageType>{ _stage };
+}
+
+template<typename ItemType, typename StageType>
+auto Pargon::Pipeline<ItemType, StageType>::Chunk(int size) const -> Pipeline<typename PipelineChunk<ValueType, StageType>::ChunkType, PipelineChunk<ValueType, StageType>>
+{
+	return PipelineChunk<ValueType, StageType>{ _stage, size };
+}
+
+template<typename ItemType, typename StageType>
+template<typename ActionType>
+void Pargon::Pipeline<ItemType, StageType>::ForEach(ActionType action) const
+{
+	auto sink = [&action](auto&& item) -> bool
+	{
+		action(std::forward<decltype(item)>(item));
+		return true;
+	};
+
+	_stage.Run(sink);
+}
+
+template<typename ItemType, typename StageType>
+template<typename ResultType, typename AccumulatorType>
+auto Pargon::Pipeline<ItemType, StageType>::Reduce(ResultType identity, AccumulatorType accumulator) const -> ResultType
+{
+	auto sink = [&identity, &accumulator](auto&& item) -> bool
+	{
+		identity = accumulator(std::move(identity), std::forward<decltype(item)>(item));
+		return true;
+	};
+
+	_stage.Run(sink);
+	return identity;
+}
+
+template<typename ItemType, typename StageType>
+auto Pargon::Pipeline<ItemType, StageType>::Count() const -> int
+{
+	auto count = 0;
+
+	auto sink = [&count](auto&&) -> bool
+	{
+		count++;
+		return true;
+	};
+
+	_stage.Run(sink);
+	return count;
+}
+
+template<typename ItemType, typename StageType>
+auto Pargon::Pipeline<ItemType, StageType>::ToList() const -> List<ValueType>
+{
+	List<ValueType> list;
+	list.EnsureCapacity(_stage.Bound());
+
+	auto sink = [&list](auto&& item) -> bool
+	{
+		list.Add(ValueType(std::forward<decltype(item)>(item)));
+		return true;
+	};
+
+	_stage.Run(sink);
+	return list;
+}
+
+template<typename ItemType, typename StageType>
+template<typename KeySelectorType>
+auto Pargon::Pipeline<ItemType, StageType>::ToMap(KeySelectorType keySelector) const -> Map<std::decay_t<std::invoke_result_t<const KeySelectorType&, const ValueType&>>, ValueType>
+{
+	Map<std::decay_t<std::invoke_result_t<const KeySelectorType&, const ValueType&>>, ValueType> map;
+	map.EnsureCapacity(_stage.Bound());
+
+	auto sink = [&map, &keySelector](auto&& item) -> bool
+	{
+		auto key = keySelector(item);
+		map.AddOrSet(key, ValueType(std::forward<decltype(item)>(item)));
+		return true;
+	};
+
+	_stage.Run(sink);
+	return map;
+}
+
+template<typename ItemType, typename StageType>
+template<typename KeySelectorType, typename ItemSelectorType>
+auto Pargon::Pipeline<ItemType, StageType>::ToMap(KeySelectorType keySelector, ItemSelectorType itemSelector) const -> Map<std::decay_t<std::invoke_result_t<const KeySelectorType&, const ValueType&>>, std::decay_t<std::invoke_result_t<const ItemSelectorType&, const ValueType&>>>
+{
+	Map<std::decay_t<std::invoke_result_t<const KeySelectorType&, const ValueType&>>, std::decay_t<std::invoke_result_t<const ItemSelectorType&, const ValueType&>>> map;
+	map.EnsureCapacity(_stage.Bound());
+
+	auto sink = [&map, &keySelector, &itemSelector](auto&& item) -> bool
+	{
+		map.AddOrSet(keySelector(item), itemSelector(item));
+		return true;
+	};
+
+	_stage.Run(sink);
+	return map;
+}
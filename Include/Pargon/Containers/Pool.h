@@ -0,0 +1,291 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType>
+	class Pool
+	{
+	public:
+		struct Statistics
+		{
+			int SlabCount;
+			int Capacity;
+			int LiveCount;
+			long long Allocations;
+			long long Deallocations;
+		};
+
+		static constexpr int DefaultSlabSize = 256;
+
+		explicit Pool(int slabSize = DefaultSlabSize, bool useThreadCaches = false);
+		Pool(const Pool<ItemType>& copy) = delete;
+		~Pool();
+
+		auto operator=(const Pool<ItemType>& copy) -> Pool<ItemType>& = delete;
+
+		template<typename... ConstructorParameterTypes> auto Create(ConstructorParameterTypes&&... constructorParameters) -> ItemType*;
+		void Destroy(ItemType* item);
+
+		void FlushThreadCache();
+		auto GetStatistics() const -> Statistics;
+
+	private:
+		union Node
+		{
+			Node* Next;
+			alignas(ItemType) unsigned char Storage[sizeof(ItemType)];
+		};
+
+		struct ThreadCache
+		{
+			Pool<ItemType>* Owner = nullptr;
+			unsigned long long OwnerId = 0;
+			Node* Head = nullptr;
+			int Count = 0;
+
+			~ThreadCache();
+		};
+
+		static constexpr int CacheBatchSize = 32;
+
+		inline static std::atomic<unsigned long long> _nextId = 1;
+		inline static std::mutex _registryMutex;
+		inline static List<Pool<ItemType>*> _registry;
+		inline static thread_local ThreadCache _threadCache;
+
+		unsigned long long _id;
+		int _slabSize;
+		bool _useThreadCaches;
+
+		mutable std::mutex _mutex;
+		List<Node*> _slabs;
+		Node* _free = nullptr;
+
+		std::atomic<long long> _allocations = 0;
+		std::atomic<long long> _deallocations = 0;
+
+		static void ReleaseCache(ThreadCache& cache);
+
+		auto Allocate() -> Node*;
+		void Deallocate(Node* node);
+		auto AcquireCache() -> ThreadCache&;
+		void AddSlab();
+	};
+}
+
+template<typename ItemType>
+Pargon::Pool<ItemType>::Pool(int slabSize, bool useThreadCaches) :
+	_id(_nextId++),
+	_slabSize(slabSize),
+	_useThreadCaches(useThreadCaches)
+{
+	assert(slabSize > 0);
+
+	std::lock_guard<std::mutex> lock(_registryMutex);
+	_registry.Add(this);
+}
+
+template<typename ItemType>
+Pargon::Pool<ItemType>::~Pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(_registryMutex);
+		_registry.Remove(this);
+	}
+
+	if (_threadCache.OwnerId == _id)
+		_threadCache = {};
+
+	for (auto slab : _slabs)
+		::operator delete(slab, std::align_val_t(alignof(Node)));
+}
+
+template<typename ItemType>
+template<typename... ConstructorParameterTypes>
+auto Pargon::Pool<ItemType>::Create(ConstructorParameterTypes&&... constructorParameters) -> ItemType*
+{
+	auto node = Allocate();
+
+	try
+	{
+		return ::new(static_cast<void*>(node->Storage)) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+	}
+	catch (...)
+	{
+		Deallocate(node);
+		throw;
+	}
+}
+
+template<typename ItemType>
+void Pargon::Pool<ItemType>::Destroy(ItemType* item)
+{
+	if (item == nullptr)
+		return;
+
+	std::destroy_at(item);
+	Deallocate(reinterpret_cast<Node*>(item));
+}
+
+template<typename ItemType>
+void Pargon::Pool<ItemType>::FlushThreadCache()
+{
+	if (_threadCache.OwnerId == _id)
+		ReleaseCache(_threadCache);
+}
+
+template<typename ItemType>
+auto Pargon::Pool<ItemType>::GetStatistics() const -> Statistics
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto allocations = _allocations.load(std::memory_order_relaxed);
+	auto deallocations = _deallocations.load(std::memory_order_relaxed);
+
+	return { _slabs.Count(), _slabs.Count() * _slabSize, static_cast<int>(allocations - deallocations), allocations, deallocations };
+}
+
+template<typename ItemType>
+Pargon::Pool<ItemType>::ThreadCache::~ThreadCache()
+{
+	if (Count > 0)
+		ReleaseCache(*this);
+}
+
+template<typename ItemType>
+void Pargon::Pool<ItemType>::ReleaseCache(ThreadCache& cache)
+{
+	{
+		std::lock_guard<std::mutex> registryLock(_registryMutex);
+
+		if (cache.Head != nullptr && _registry.Find(cache.Owner) != Sequence::InvalidIndex && cache.Owner->_id == cache.OwnerId)
+		{
+			auto tail = cache.Head;
+			while (tail->Next != nullptr)
+				tail = tail->Next;
+
+			std::lock_guard<std::mutex> lock(cache.Owner->_mutex);
+			tail->Next = cache.Owner->_free;
+			cache.Owner->_free = cache.Head;
+		}
+	}
+
+	cache = {};
+}
+
+template<typename ItemType>
+auto Pargon::Pool<ItemType>::Allocate() -> Node*
+{
+	_allocations.fetch_add(1, std::memory_order_relaxed);
+
+	if (_useThreadCaches)
+	{
+		auto& cache = AcquireCache();
+
+		if (cache.Head == nullptr)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			while (cache.Count < CacheBatchSize)
+			{
+				if (_free == nullptr)
+					AddSlab();
+
+				auto node = _free;
+				_free = node->Next;
+				node->Next = cache.Head;
+				cache.Head = node;
+				cache.Count++;
+			}
+		}
+
+		auto node = cache.Head;
+		cache.Head = node->Next;
+		cache.Count--;
+		return node;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (_free == nullptr)
+		AddSlab();
+
+	auto node = _free;
+	_free = node->Next;
+	return node;
+}
+
+template<typename ItemType>
+void Pargon::Pool<ItemType>::Deallocate(Node* node)
+{
+	_deallocations.fetch_add(1, std::memory_order_relaxed);
+
+	if (_useThreadCaches)
+	{
+		auto& cache = AcquireCache();
+
+		node->Next = cache.Head;
+		cache.Head = node;
+		cache.Count++;
+
+		if (cache.Count >= CacheBatchSize * 2)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			while (cache.Count > CacheBatchSize)
+			{
+				auto returned = cache.Head;
+				cache.Head = returned->Next;
+				cache.Count--;
+
+				returned->Next = _free;
+				_free = returned;
+			}
+		}
+
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	node->Next = _free;
+	_free = node;
+}
+
+template<typename ItemType>
+auto Pargon::Pool<ItemType>::AcquireCache() -> ThreadCache&
+{
+	auto& cache = _threadCache;
+
+	if (cache.OwnerId != _id)
+	{
+		if (cache.Count > 0)
+			ReleaseCache(cache);
+
+		cache.Owner = this;
+		cache.OwnerId = _id;
+	}
+
+	return cache;
+}
+
+template<typename ItemType>
+void Pargon::Pool<ItemType>::AddSlab()
+{
+	auto slab = static_cast<Node*>(::operator new(sizeof(Node) * _slabSize, std::align_val_t(alignof(Node))));
+	_slabs.Add(slab);
+
+	for (auto i = _slabSize - 1; i >= 0; i--)
+	{
+		slab[i].Next = _free;
+		_free = slab + i;
+	}
+}
@@ -0,0 +1,320 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <cassert>
+#include <functional>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType, typename CompareType = std::less<ItemType>>
+	class PriorityQueue
+	{
+	public:
+		static constexpr int Arity = 4;
+
+		PriorityQueue() = default;
+		PriorityQueue(SequenceView<ItemType> items, CompareType compare = CompareType());
+		explicit PriorityQueue(CompareType compare);
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+
+		auto First() const -> const ItemType&;
+		auto FirstHandle() const -> int;
+		auto Contains(int handle) const -> bool;
+		auto Item(int handle) const -> const ItemType&;
+		void SetItem(int handle, ItemType&& item);
+		void SetItem(int handle, const ItemType& item);
+
+		auto Items() const -> SequenceView<ItemType>;
+
+		void EnsureCapacity(int capacity);
+
+		auto Add(ItemType&& item) -> int;
+		auto Add(const ItemType& item) -> int;
+
+		auto TakeFirst() -> ItemType;
+		auto RemoveFirst() -> bool;
+		auto Remove(int handle) -> bool;
+
+		void Clear();
+
+	private:
+		List<ItemType> _items;
+		List<int> _handles;
+		List<int> _positions;
+		List<int> _freeHandles;
+		CompareType _compare;
+
+		auto AllocateHandle(int position) -> int;
+		void RemoveAt(int position);
+		void Place(int position, ItemType&& item, int handle);
+		void SiftUp(int position);
+		void SiftDown(int position);
+	};
+}
+
+template<typename ItemType, typename CompareType>
+Pargon::PriorityQueue<ItemType, CompareType>::PriorityQueue(SequenceView<ItemType> items, CompareType compare) :
+	_items(items),
+	_compare(std::move(compare))
+{
+	_handles.SetCountUninitialized(items.Count());
+	_positions.SetCountUninitialized(items.Count());
+
+	for (auto i = 0; i < items.Count(); i++)
+	{
+		_handles.SetItem(i, i);
+		_positions.SetItem(i, i);
+	}
+
+	if (items.Count() > 1)
+	{
+		for (auto i = (items.Count() - 2) / Arity; i >= 0; i--)
+			SiftDown(i);
+	}
+}
+
+template<typename ItemType, typename CompareType>
+Pargon::PriorityQueue<ItemType, CompareType>::PriorityQueue(CompareType compare) :
+	_compare(std::move(compare))
+{
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::IsEmpty() const -> bool
+{
+	return _items.IsEmpty();
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::Count() const -> int
+{
+	return _items.Count();
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::First() const -> const ItemType&
+{
+	return _items.First();
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::FirstHandle() const -> int
+{
+	return _handles.First();
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::Contains(int handle) const -> bool
+{
+	return handle >= 0 && handle < _positions.Count() && _positions.Item(handle) != Sequence::InvalidIndex;
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::Item(int handle) const -> const ItemType&
+{
+	assert(Contains(handle));
+	return _items.Item(_positions.Item(handle));
+}
+
+template<typename ItemType, typename CompareType>
+void Pargon::PriorityQueue<ItemType, CompareType>::SetItem(int handle, ItemType&& item)
+{
+	assert(Contains(handle));
+
+	auto position = _positions.Item(handle);
+	auto raise = _compare(item, _items.Item(position));
+
+	_items.SetItem(position, std::move(item));
+
+	if (raise)
+		SiftUp(position);
+	else
+		SiftDown(position);
+}
+
+template<typename ItemType, typename CompareType>
+void Pargon::PriorityQueue<ItemType, CompareType>::SetItem(int handle, const ItemType& item)
+{
+	SetItem(handle, ItemType(item));
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::Items() const -> SequenceView<ItemType>
+{
+	return _items.GetView();
+}
+
+template<typename ItemType, typename CompareType>
+void Pargon::PriorityQueue<ItemType, CompareType>::EnsureCapacity(int capacity)
+{
+	_items.EnsureCapacity(capacity);
+	_handles.EnsureCapacity(capacity);
+	_positions.EnsureCapacity(capacity);
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::Add(ItemType&& item) -> int
+{
+	auto position = _items.Count();
+	auto handle = AllocateHandle(position);
+
+	_items.Add(std::move(item));
+	_handles.Add(handle);
+
+	SiftUp(position);
+	return handle;
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::Add(const ItemType& item) -> int
+{
+	return Add(ItemType(item));
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::TakeFirst() -> ItemType
+{
+	assert(!_items.IsEmpty());
+
+	auto item = std::move(_items.First());
+	RemoveAt(0);
+	return item;
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::RemoveFirst() -> bool
+{
+	if (_items.IsEmpty())
+		return false;
+
+	RemoveAt(0);
+	return true;
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::Remove(int handle) -> bool
+{
+	if (!Contains(handle))
+		return false;
+
+	RemoveAt(_positions.Item(handle));
+	return true;
+}
+
+template<typename ItemType, typename CompareType>
+void Pargon::PriorityQueue<ItemType, CompareType>::Clear()
+{
+	_items.Clear();
+	_handles.Clear();
+	_positions.Clear();
+	_freeHandles.Clear();
+}
+
+template<typename ItemType, typename CompareType>
+auto Pargon::PriorityQueue<ItemType, CompareType>::AllocateHandle(int position) -> int
+{
+	if (_freeHandles.IsEmpty())
+	{
+		_positions.Add(position);
+		return _positions.LastIndex();
+	}
+
+	auto handle = _freeHandles.Last();
+	_freeHandles.RemoveLast();
+	_positions.SetItem(handle, position);
+	return handle;
+}
+
+template<typename ItemType, typename CompareType>
+void Pargon::PriorityQueue<ItemType, CompareType>::RemoveAt(int position)
+{
+	auto handle = _handles.Item(position);
+	auto last = _items.LastIndex();
+
+	_positions.SetItem(handle, Sequence::InvalidIndex);
+	_freeHandles.Add(handle);
+
+	if (position != last)
+	{
+		Place(position, std::move(_items.Item(last)), _handles.Item(last));
+
+		_items.RemoveLast();
+		_handles.RemoveLast();
+
+		if (position > 0 && _compare(_items.Item(position), _items.Item((position - 1) / Arity)))
+			SiftUp(position);
+		else
+			SiftDown(position);
+	}
+	else
+	{
+		_items.RemoveLast();
+		_handles.RemoveLast();
+	}
+}
+
+template<typename ItemType, typename CompareType>
+void Pargon::PriorityQueue<ItemType, CompareType>::Place(int position, ItemType&& item, int handle)
+{
+	_items.SetItem(position, std::move(item));
+	_handles.SetItem(position, handle);
+	_positions.SetItem(handle, position);
+}
+
+template<typename ItemType, typename CompareType>
+void Pargon::PriorityQueue<ItemType, CompareType>::SiftUp(int position)
+{
+	auto item = std::move(_items.Item(position));
+	auto handle = _handles.Item(position);
+
+	while (position > 0)
+	{
+		auto parent = (position - 1) / Arity;
+
+		if (!_compare(item, _items.Item(parent)))
+			break;
+
+		Place(position, std::move(_items.Item(parent)), _handles.Item(parent));
+		position = parent;
+	}
+
+	Place(position, std::move(item), handle);
+}
+
+template<typename ItemType, typename CompareType>
+void Pargon::PriorityQueue<ItemType, CompareType>::SiftDown(int position)
+{
+	auto count = _items.Count();
+	auto item = std::move(_items.Item(position));
+	auto handle = _handles.Item(position);
+
+	while (true)
+	{
+		auto first = position * Arity + 1;
+
+		if (first >= count)
+			break;
+
+		auto last = first + Arity < count ? first + Arity : count;
+		auto best = first;
+
+		for (auto child = first + 1; child < last; child++)
+		{
+			if (_compare(_items.Item(child), _items.Item(best)))
+				best = child;
+		}
+
+		if (!_compare(_items.Item(best), item))
+			break;
+
+		Place(position, std::move(_items.Item(best)), _handles.Item(best));
+		position = best;
+	}
+
+	Place(position, std::move(item), handle);
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Pargon
+{
+	class Searching
+	{
+	public:
+		static constexpr int InvalidIndex = -1;
+
+		template<typename ItemType> static constexpr bool IsVectorizable = (std::is_arithmetic<ItemType>::value || std::is_pointer<ItemType>::value) && (sizeof(ItemType) == 1 || sizeof(ItemType) == 2 || sizeof(ItemType) == 4 || sizeof(ItemType) == 8);
+
+		template<typename ItemType> static auto IndexOf(const ItemType* items, int count, const ItemType& item) -> int;
+		template<typename ItemType> static auto CountOf(const ItemType* items, int count, const ItemType& item) -> int;
+		template<typename ItemType> static auto IndicesOf(const ItemType* items, int count, const ItemType& item, int* indices) -> int;
+
+	private:
+		template<int Size> struct BitsType;
+
+		static auto VectorIndexOf(const uint8_t* items, int count, uint8_t item) -> int;
+		static auto VectorIndexOf(const uint16_t* items, int count, uint16_t item) -> int;
+		static auto VectorIndexOf(const uint32_t* items, int count, uint32_t item) -> int;
+		static auto VectorIndexOf(const uint64_t* items, int count, uint64_t item) -> int;
+		static auto VectorIndexOf(const float* items, int count, float item) -> int;
+		static auto VectorIndexOf(const double* items, int count, double item) -> int;
+
+		static auto VectorCountOf(const uint8_t* items, int count, uint8_t item) -> int;
+		static auto VectorCountOf(const uint16_t* items, int count, uint16_t item) -> int;
+		static auto VectorCountOf(const uint32_t* items, int count, uint32_t item) -> int;
+		static auto VectorCountOf(const uint64_t* items, int count, uint64_t item) -> int;
+		static auto VectorCountOf(const float* items, int count, float item) -> int;
+		static auto VectorCountOf(const double* items, int count, double item) -> int;
+
+		static auto VectorIndicesOf(const uint8_t* items, int count, uint8_t item, int* indices) -> int;
+		static auto VectorIndicesOf(const uint16_t* items, int count, uint16_t item, int* indices) -> int;
+		static auto VectorIndicesOf(const uint32_t* items, int count, uint32_t item, int* indices) -> int;
+		static auto VectorIndicesOf(const uint64_t* items, int count, uint64_t item, int* indices) -> int;
+		static auto VectorIndicesOf(const float* items, int count, float item, int* indices) -> int;
+		static auto VectorIndicesOf(const double* items, int count, double item, int* indices) -> int;
+
+		template<typename ItemType> static auto ToBits(const ItemType& item);
+		template<typename ItemType> static auto ToBits(const ItemType* items);
+	};
+}
+
+template<> struct Pargon::Searching::BitsType<1> { using Type = uint8_t; };
+template<> struct Pargon::Searching::BitsType<2> { using Type = uint16_t; };
+template<> struct Pargon::Searching::BitsType<4> { using Type = uint32_t; };
+template<> struct Pargon::Searching::BitsType<8> { using Type = uint64_t; };
+
+template<typename ItemType>
+auto Pargon::Searching::IndexOf(const ItemType* items, int count, const ItemType& item) -> int
+{
+	if constexpr (std::is_same<ItemType, float>::value || std::is_same<ItemType, double>::value)
+	{
+		return VectorIndexOf(items, count, item);
+	}
+	else if constexpr (IsVectorizable<ItemType> && !std::is_floating_point<ItemType>::value)
+	{
+		return VectorIndexOf(ToBits(items), count, ToBits(item));
+	}
+	else
+	{
+		auto iterator = std::find(items, items + count, item);
+		return iterator == items + count ? InvalidIndex : static_cast<int>(iterator - items);
+	}
+}
+
+template<typename ItemType>
+auto Pargon::Searching::CountOf(const ItemType* items, int count, const ItemType& item) -> int
+{
+	if constexpr (std::is_same<ItemType, float>::value || std::is_same<ItemType, double>::value)
+		return VectorCountOf(items, count, item);
+	else if constexpr (IsVectorizable<ItemType> && !std::is_floating_point<ItemType>::value)
+		return VectorCountOf(ToBits(items), count, ToBits(item));
+	else
+		return static_cast<int>(std::count(items, items + count, item));
+}
+
+template<typename ItemType>
+auto Pargon::Searching::IndicesOf(const ItemType* items, int count, const ItemType& item, int* indices) -> int
+{
+	if constexpr (std::is_same<ItemType, float>::value || std::is_same<ItemType, double>::value)
+	{
+		return VectorIndicesOf(items, count, item, indices);
+	}
+	else if constexpr (IsVectorizable<ItemType> && !std::is_floating_point<ItemType>::value)
+	{
+		return VectorIndicesOf(ToBits(items), count, ToBits(item), indices);
+	}
+	else
+	{
+		auto found = 0;
+
+		for (auto i = 0; i < count; i++)
+		{
+			if (items[i] == item)
+				indices[found++] = i;
+		}
+
+		return found;
+	}
+}
+
+template<typename ItemType>
+auto Pargon::Searching::ToBits(const ItemType& item)
+{
+	typename BitsType<sizeof(ItemType)>::Type bits;
+	std::memcpy(&bits, &item, sizeof(ItemType));
+	return bits;
+}
+
+template<typename ItemType>
+auto Pargon::Searching::ToBits(const ItemType* items)
+{
+	return reinterpret_cast<const typename BitsType<sizeof(ItemType)>::Type*>(items);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+namespace Pargon
+{
+	template<typename ItemType>
+	class SearchTree
+	{
+	public:
+		SearchTree() = default;
+		SearchTree(SequenceView<ItemType> sortedItems);
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+
+		auto LowerBound(const ItemType& item) const -> int;
+		auto IndexOf(const ItemType& item) const -> int;
+		auto Contains(const ItemType& item) const -> bool;
+
+	private:
+		List<ItemType> _items;
+		List<int> _indices;
+
+		void Build(int node, int& index);
+		auto LowerSlot(const ItemType& item) const -> int;
+	};
+}
+
+template<typename ItemType>
+Pargon::SearchTree<ItemType>::SearchTree(SequenceView<ItemType> sortedItems)
+{
+	auto index = 0;
+
+	_indices.SetCountUninitialized(sortedItems.Count());
+	Build(0, index);
+
+	_items.EnsureCapacity(sortedItems.Count());
+	for (auto sortedIndex : _indices)
+		_items.Add(sortedItems.Item(sortedIndex));
+}
+
+template<typename ItemType>
+auto Pargon::SearchTree<ItemType>::IsEmpty() const -> bool
+{
+	return _items.IsEmpty();
+}
+
+template<typename ItemType>
+auto Pargon::SearchTree<ItemType>::Count() const -> int
+{
+	return _items.Count();
+}
+
+template<typename ItemType>
+auto Pargon::SearchTree<ItemType>::LowerBound(const ItemType& item) const -> int
+{
+	auto slot = LowerSlot(item);
+	return slot == Sequence::InvalidIndex ? _items.Count() : _indices.Item(slot);
+}
+
+template<typename ItemType>
+auto Pargon::SearchTree<ItemType>::IndexOf(const ItemType& item) const -> int
+{
+	auto slot = LowerSlot(item);
+	return slot == Sequence::InvalidIndex || item < _items.Item(slot) ? Sequence::InvalidIndex : _indices.Item(slot);
+}
+
+template<typename ItemType>
+auto Pargon::SearchTree<ItemType>::Contains(const ItemType& item) const -> bool
+{
+	return IndexOf(item) != Sequence::InvalidIndex;
+}
+
+template<typename ItemType>
+void Pargon::SearchTree<ItemType>::Build(int node, int& index)
+{
+	if (node < _indices.Count())
+	{
+		Build(2 * node + 1, index);
+		_indices.SetItem(node, index++);
+		Build(2 * node + 2, index);
+	}
+}
+
+template<typename ItemType>
+auto Pargon::SearchTree<ItemType>::LowerSlot(const ItemType& item) const -> int
+{
+	auto data = _items.begin();
+	auto count = static_cast<unsigned int>(_items.Count());
+	auto node = 0u;
+
+	while (node < count)
+		node = 2 * node + 1 + (data[node] < item ? 1 : 0);
+
+	node += 1;
+	while (node & 1)
+		node >>= 1;
+
+	node >>= 1;
+	return static_cast<int>(node) - 1;
+}
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Pargon/Containers/Function.h"
+#include "Pargon/Containers/Search.h"
+#include "Pargon/Containers/Sort.h"
 
 #include <algorithm>
 #include <cassert>
 #include <initializer_list>
+#include <type_traits>
 
 namespace Pargon
 {
@@ -13,10 +16,16 @@ namespace Pargon
 		static constexpr int InvalidIndex = -1;
 	};
 
-	template<typename ItemType, int N> class Array;
+	template<typename ItemType, int N, int Alignment = alignof(ItemType)> class Array;
+	template<typename KeyType> struct GroupIndex;
 	template<typename ItemType> class List;
+	template<typename KeyType, typename ItemType> class Map;
+	template<typename ItemType, typename StageType> class Pipeline;
+	template<typename ItemType> struct PipelineSource;
 	template<typename ItemType> class SequenceReference;
 
+	template<typename KeySelectorType, typename ItemType> using GroupKey = std::decay_t<std::invoke_result_t<const KeySelectorType&, const ItemType&>>;
+
 	template<typename ItemType>
 	class SequenceView
 	{
@@ -26,7 +35,7 @@ namespace Pargon
 		SequenceView() = default;
 		SequenceView(SequenceReference<ItemType> sequence);
 		SequenceView(const List<ItemType>& list);
-		template<int N> SequenceView(const Array<ItemType, N>& array);
+		template<int N, int Alignment> SequenceView(const Array<ItemType, N, Alignment>& array);
 		template<int N> SequenceView(ItemType const (&array)[N]);
 		SequenceView(const std::initializer_list<ItemType>& initializer);
 		SequenceView(const ItemType* pointer, int count);
@@ -44,14 +53,47 @@ namespace Pargon
 		auto GetSubview(int index) const -> SequenceView<ItemType>;
 		auto GetSubview(int index, int count) const -> SequenceView<ItemType>;
 
-		auto Contains(const ItemType& item) -> bool;
-		auto Contains(FunctionView<bool(const ItemType&)> comparer) -> bool;
-		auto IndexOf(const ItemType& item) -> int;
-		auto IndexOf(FunctionView<bool(const ItemType&)> comparer) -> int;
+		auto Contains(const ItemType& item) const -> bool;
+		auto Contains(FunctionView<bool(const ItemType&)> comparer) const -> bool;
+		auto IndexOf(const ItemType& item) const -> int;
+		auto IndexOf(FunctionView<bool(const ItemType&)> comparer) const -> int;
+		auto CountOf(const ItemType& item) const -> int;
+		auto IndicesOf(const ItemType& item) const -> List<int>;
+
+		auto LowerBound(const ItemType& item) const -> int;
+		auto LowerBound(const ItemType& item, FunctionView<bool(const ItemType&, const ItemType&)> comparer) const -> int;
+		auto UpperBound(const ItemType& item) const -> int;
+		auto UpperBound(const ItemType& item, FunctionView<bool(const ItemType&, const ItemType&)> comparer) const -> int;
+		auto BinarySearch(const ItemType& item) const -> int;
+		auto BinarySearch(const ItemType& item, FunctionView<bool(const ItemType&, const ItemType&)> comparer) const -> int;
+		auto EqualRange(const ItemType& item) const -> SequenceView<ItemType>;
+		auto EqualRange(const ItemType& item, FunctionView<bool(const ItemType&, const ItemType&)> comparer) const -> SequenceView<ItemType>;
+
+		auto SortedUnion(SequenceView<ItemType> other) const -> List<ItemType>;
+		auto SortedIntersection(SequenceView<ItemType> other) const -> List<ItemType>;
+		auto SortedDifference(SequenceView<ItemType> other) const -> List<ItemType>;
+
+		auto Distinct() const -> List<ItemType>;
+		template<typename KeySelectorType> auto GroupBy(KeySelectorType keySelector) const -> Map<GroupKey<KeySelectorType, ItemType>, List<ItemType>>;
+		template<typename KeySelectorType> auto GroupIndices(KeySelectorType keySelector) const -> GroupIndex<GroupKey<KeySelectorType, ItemType>>;
+		template<typename KeySelectorType> auto CountBy(KeySelectorType keySelector) const -> Map<GroupKey<KeySelectorType, ItemType>, int>;
+
+		void ParallelForEach(FunctionView<void(const ItemType&)> action) const;
+		template<typename ResultType> void ParallelTransform(SequenceReference<ResultType> results, FunctionView<ResultType(const ItemType&)> transform) const;
+		auto ParallelReduce(ItemType identity, FunctionView<ItemType(const ItemType&, const ItemType&)> reducer) const -> ItemType;
+		template<typename ResultType> auto ParallelReduce(ResultType identity, FunctionView<ResultType(const ResultType&, const ItemType&)> accumulator, FunctionView<ResultType(const ResultType&, const ResultType&)> combiner) const -> ResultType;
+		auto ParallelCount(FunctionView<bool(const ItemType&)> predicate) const -> int;
+
+		auto Pipe() const -> Pipeline<const ItemType&, PipelineSource<const ItemType>>;
 
 	private:
+		static constexpr int GallopRatio = 32;
+
 		const ItemType* _data = nullptr;
 		int _count = 0;
+
+		template<typename PredicateType> auto PartitionPoint(PredicateType predicate) const -> int;
+		auto Gallop(int start, const ItemType& item) const -> int;
 	};
 
 	template<typename ItemType>
@@ -62,7 +104,7 @@ namespace Pargon
 
 		SequenceReference() = default;
 		SequenceReference(List<ItemType>& list);
-		template<int N> SequenceReference(Array<ItemType, N>& array);
+		template<int N, int Alignment> SequenceReference(Array<ItemType, N, Alignment>& array);
 		template<int N> SequenceReference(ItemType (&array)[N]);
 		SequenceReference(ItemType* pointer, int count);
 
@@ -85,8 +127,23 @@ namespace Pargon
 		auto GetSubreference(int index, int count) const -> SequenceReference<ItemType>;
 
 		void Reverse();
+		auto Unique() -> int;
 		void Sort();
 		void Sort(FunctionView<bool(const ItemType&, const ItemType&)> comparer);
+		void StableSort();
+		void StableSort(FunctionView<bool(const ItemType&, const ItemType&)> comparer);
+		void PartialSort(int count);
+		void PartialSort(int count, FunctionView<bool(const ItemType&, const ItemType&)> comparer);
+		void NthElement(int index);
+		void NthElement(int index, FunctionView<bool(const ItemType&, const ItemType&)> comparer);
+		void RadixSort();
+		template<typename KeyType> void RadixSort(FunctionView<KeyType(const ItemType&)> key);
+
+		void ParallelForEach(FunctionView<void(ItemType&)> action) const;
+		void ParallelSort();
+		void ParallelSort(FunctionView<bool(const ItemType&, const ItemType&)> comparer);
+
+		auto Pipe() const -> Pipeline<ItemType&, PipelineSource<ItemType>>;
 
 	private:
 		ItemType* _data = nullptr;
@@ -186,35 +243,135 @@ auto Pargon::SequenceView<ItemType>::GetSubview(int index, int count) const -> S
 	if (index + count > _count)
 		return {};
 
-	return { _data + index, count };
+	return SequenceView<ItemType>(_data + index, count);
 }
 
 template<typename ItemType>
-auto Pargon::SequenceView<ItemType>::Contains(const ItemType& item) -> bool
+auto Pargon::SequenceView<ItemType>::Contains(const ItemType& item) const -> bool
 {
-	return std::find(begin(), end(), item) != end();
+	return Searching::IndexOf(_data, _count, item) != Searching::InvalidIndex;
 }
 
 template<typename ItemType>
-auto Pargon::SequenceView<ItemType>::Contains(FunctionView<bool(const ItemType&)> comparer) -> bool
+auto Pargon::SequenceView<ItemType>::Contains(FunctionView<bool(const ItemType&)> comparer) const -> bool
 {
 	return std::find_if(begin(), end(), comparer) != end();
 }
 
 template<typename ItemType>
-auto Pargon::SequenceView<ItemType>::IndexOf(const ItemType& item) -> int
+auto Pargon::SequenceView<ItemType>::IndexOf(const ItemType& item) const -> int
 {
-	auto iterator = std::find(begin(), end(), item);
-	return iterator == end() ? Sequence::InvalidIndex : static_cast<int>(iterator - begin());
+	auto index = Searching::IndexOf(_data, _count, item);
+	return index == Searching::InvalidIndex ? Sequence::InvalidIndex : index;
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::CountOf(const ItemType& item) const -> int
+{
+	return Searching::CountOf(_data, _count, item);
 }
 
 template<typename ItemType>
-auto Pargon::SequenceView<ItemType>::IndexOf(FunctionView<bool(const ItemType&)> comparer) -> int
+auto Pargon::SequenceView<ItemType>::IndexOf(FunctionView<bool(const ItemType&)> comparer) const -> int
 {
 	auto iterator = std::find_if(begin(), end(), comparer);
 	return iterator == end() ? Sequence::InvalidIndex : static_cast<int>(iterator - begin());
 }
 
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::LowerBound(const ItemType& item) const -> int
+{
+	return PartitionPoint([&item](const ItemType& other) { return other < item; });
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::LowerBound(const ItemType& item, FunctionView<bool(const ItemType&, const ItemType&)> comparer) const -> int
+{
+	return PartitionPoint([&item, &comparer](const ItemType& other) { return comparer(other, item); });
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::UpperBound(const ItemType& item) const -> int
+{
+	return PartitionPoint([&item](const ItemType& other) { return !(item < other); });
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::UpperBound(const ItemType& item, FunctionView<bool(const ItemType&, const ItemType&)> comparer) const -> int
+{
+	return PartitionPoint([&item, &comparer](const ItemType& other) { return !comparer(item, other); });
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::BinarySearch(const ItemType& item) const -> int
+{
+	auto index = LowerBound(item);
+	return index < _count && !(item < _data[index]) ? index : Sequence::InvalidIndex;
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::BinarySearch(const ItemType& item, FunctionView<bool(const ItemType&, const ItemType&)> comparer) const -> int
+{
+	auto index = LowerBound(item, comparer);
+	return index < _count && !comparer(item, _data[index]) ? index : Sequence::InvalidIndex;
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::EqualRange(const ItemType& item) const -> SequenceView<ItemType>
+{
+	auto start = LowerBound(item);
+	auto end = start + GetSubview(start).UpperBound(item);
+	return GetSubview(start, end - start);
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::EqualRange(const ItemType& item, FunctionView<bool(const ItemType&, const ItemType&)> comparer) const -> SequenceView<ItemType>
+{
+	auto start = LowerBound(item, comparer);
+	auto end = start + GetSubview(start).UpperBound(item, comparer);
+	return GetSubview(start, end - start);
+}
+
+template<typename ItemType>
+template<typename PredicateType>
+auto Pargon::SequenceView<ItemType>::PartitionPoint(PredicateType predicate) const -> int
+{
+	if (_count == 0)
+		return 0;
+
+	auto base = _data;
+	auto count = _count;
+
+	while (count > 1)
+	{
+		auto half = count / 2;
+		base = predicate(base[half - 1]) ? base + half : base;
+		count -= half;
+	}
+
+	return static_cast<int>(base - _data) + (predicate(*base) ? 1 : 0);
+}
+
+template<typename ItemType>
+auto Pargon::SequenceView<ItemType>::Gallop(int start, const ItemType& item) const -> int
+{
+	auto step = 1;
+	auto low = start;
+	auto high = start;
+
+	while (high < _count && _data[high] < item)
+	{
+		low = high + 1;
+		high = start + step;
+		step *= 2;
+	}
+
+	if (high > _count)
+		high = _count;
+
+	return low + GetSubview(low, high - low).LowerBound(item);
+}
+
 template<typename ItemType>
 template<int N>
 Pargon::SequenceReference<ItemType>::SequenceReference(ItemType (&array)[N]) :
@@ -313,7 +470,7 @@ auto Pargon::SequenceReference<ItemType>::GetView(int index, int count) const ->
 	if (index < 0 || index + count > _count)
 		return {};
 
-	return { _data + index, count };
+	return SequenceView<ItemType>(_data + index, count);
 }
 
 template<typename ItemType>
@@ -337,14 +494,73 @@ void Pargon::SequenceReference<ItemType>::Reverse()
 	std::reverse(begin(), end());
 }
 
+template<typename ItemType>
+auto Pargon::SequenceReference<ItemType>::Unique() -> int
+{
+	return static_cast<int>(std::unique(begin(), end()) - begin());
+}
+
 template<typename ItemType>
 void Pargon::SequenceReference<ItemType>::Sort()
 {
-	std::sort(begin(), end());
+	Sorting::PatternDefeating(begin(), end(), std::less<ItemType>());
 }
 
 template<typename ItemType>
 void Pargon::SequenceReference<ItemType>::Sort(FunctionView<bool(const ItemType&, const ItemType&)> comparer)
 {
-	std::sort(begin(), end(), comparer);
+	Sorting::PatternDefeating(begin(), end(), comparer);
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::StableSort()
+{
+	std::stable_sort(begin(), end());
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::StableSort(FunctionView<bool(const ItemType&, const ItemType&)> comparer)
+{
+	std::stable_sort(begin(), end(), comparer);
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::PartialSort(int count)
+{
+	assert(count >= 0 && count <= _count);
+	std::partial_sort(begin(), begin() + count, end());
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::PartialSort(int count, FunctionView<bool(const ItemType&, const ItemType&)> comparer)
+{
+	assert(count >= 0 && count <= _count);
+	std::partial_sort(begin(), begin() + count, end(), comparer);
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::NthElement(int index)
+{
+	assert(index >= 0 && index < _count);
+	std::nth_element(begin(), begin() + index, end());
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::NthElement(int index, FunctionView<bool(const ItemType&, const ItemType&)> comparer)
+{
+	assert(index >= 0 && index < _count);
+	std::nth_element(begin(), begin() + index, end(), comparer);
+}
+
+template<typename ItemType>
+void Pargon::SequenceReference<ItemType>::RadixSort()
+{
+	Sorting::Radix(_data, _count);
+}
+
+template<typename ItemType>
+template<typename KeyType>
+void Pargon::SequenceReference<ItemType>::RadixSort(FunctionView<KeyType(const ItemType&)> key)
+{
+	Sorting::Radix(_data, _count, key);
 }
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <cassert>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType>
+	class SlotMap
+	{
+	public:
+		struct Handle
+		{
+			int Index = Sequence::InvalidIndex;
+			unsigned int Generation = 0;
+
+			auto operator==(const Handle& other) const -> bool { return Index == other.Index && Generation == other.Generation; }
+			auto operator!=(const Handle& other) const -> bool { return !(*this == other); }
+		};
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto LastIndex() const -> int;
+
+		auto Contains(Handle handle) const -> bool;
+
+		auto ItemWithHandle(Handle handle) -> ItemType&;
+		auto ItemWithHandle(Handle handle) const -> const ItemType&;
+		auto ItemAtIndex(int index) -> ItemType&;
+		auto ItemAtIndex(int index) const -> const ItemType&;
+
+		auto Items() const -> SequenceView<ItemType>;
+		auto Items() -> SequenceReference<ItemType>;
+		auto GetHandle(int index) const -> Handle;
+		auto GetIndex(Handle handle) const -> int;
+
+		void EnsureCapacity(int capacity);
+
+		auto Add(ItemType&& item) -> Handle;
+		auto Add(const ItemType& item) -> Handle;
+
+		auto RemoveWithHandle(Handle handle) -> bool;
+		void RemoveAtIndex(int index);
+
+		void Clear();
+
+	private:
+		struct Slot
+		{
+			int Index;
+			unsigned int Generation;
+		};
+
+		List<ItemType> _items;
+		List<int> _slotIndices;
+		List<Slot> _slots;
+		int _freeSlot = Sequence::InvalidIndex;
+
+		auto AllocateSlot() -> Handle;
+	};
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::IsEmpty() const -> bool
+{
+	return _items.IsEmpty();
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::Count() const -> int
+{
+	return _items.Count();
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::LastIndex() const -> int
+{
+	return _items.LastIndex();
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::Contains(Handle handle) const -> bool
+{
+	return GetIndex(handle) != Sequence::InvalidIndex;
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::ItemWithHandle(Handle handle) -> ItemType&
+{
+	auto index = GetIndex(handle);
+	assert(index != Sequence::InvalidIndex);
+	return _items.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::ItemWithHandle(Handle handle) const -> const ItemType&
+{
+	auto index = GetIndex(handle);
+	assert(index != Sequence::InvalidIndex);
+	return _items.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::ItemAtIndex(int index) -> ItemType&
+{
+	return _items.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::ItemAtIndex(int index) const -> const ItemType&
+{
+	return _items.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::Items() const -> SequenceView<ItemType>
+{
+	return _items.GetView();
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::Items() -> SequenceReference<ItemType>
+{
+	return _items.GetReference();
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::GetHandle(int index) const -> Handle
+{
+	auto slotIndex = _slotIndices.Item(index);
+	return { slotIndex, _slots.Item(slotIndex).Generation };
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::GetIndex(Handle handle) const -> int
+{
+	if (handle.Index < 0 || handle.Index >= _slots.Count())
+		return Sequence::InvalidIndex;
+
+	auto& slot = _slots.Item(handle.Index);
+
+	if (slot.Generation != handle.Generation || slot.Index < 0 || slot.Index >= _items.Count() || _slotIndices.Item(slot.Index) != handle.Index)
+		return Sequence::InvalidIndex;
+
+	return slot.Index;
+}
+
+template<typename ItemType>
+void Pargon::SlotMap<ItemType>::EnsureCapacity(int capacity)
+{
+	_items.EnsureCapacity(capacity);
+	_slotIndices.EnsureCapacity(capacity);
+	_slots.EnsureCapacity(capacity);
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::Add(ItemType&& item) -> Handle
+{
+	_items.Add(std::move(item));
+	return AllocateSlot();
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::Add(const ItemType& item) -> Handle
+{
+	_items.Add(item);
+	return AllocateSlot();
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::RemoveWithHandle(Handle handle) -> bool
+{
+	auto index = GetIndex(handle);
+
+	if (index == Sequence::InvalidIndex)
+		return false;
+
+	RemoveAtIndex(index);
+	return true;
+}
+
+template<typename ItemType>
+void Pargon::SlotMap<ItemType>::RemoveAtIndex(int index)
+{
+	assert(index >= 0 && index < _items.Count());
+
+	auto slotIndex = _slotIndices.Item(index);
+	auto last = _items.LastIndex();
+
+	if (index != last)
+	{
+		_items.SetItem(index, std::move(_items.Item(last)));
+		_slotIndices.SetItem(index, _slotIndices.Item(last));
+		_slots.Item(_slotIndices.Item(index)).Index = index;
+	}
+
+	_items.RemoveLast();
+	_slotIndices.RemoveLast();
+
+	auto& slot = _slots.Item(slotIndex);
+	slot.Generation++;
+	slot.Index = _freeSlot;
+	_freeSlot = slotIndex;
+}
+
+template<typename ItemType>
+void Pargon::SlotMap<ItemType>::Clear()
+{
+	while (!_items.IsEmpty())
+		RemoveAtIndex(_items.LastIndex());
+}
+
+template<typename ItemType>
+auto Pargon::SlotMap<ItemType>::AllocateSlot() -> Handle
+{
+	auto index = _items.LastIndex();
+	auto slotIndex = _freeSlot;
+
+	if (slotIndex == Sequence::InvalidIndex)
+	{
+		slotIndex = _slots.Count();
+		_slots.Add({ index, 0 });
+	}
+	else
+	{
+		auto& slot = _slots.Item(slotIndex);
+		_freeSlot = slot.Index;
+		slot.Index = index;
+	}
+
+	_slotIndices.Add(slotIndex);
+	return { slotIndex, _slots.Item(slotIndex).Generation };
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Pargon/Containers/Function.h"
+#include "Pargon/Containers/PersistentList.h"
+#include "Pargon/Containers/PersistentMap.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ContainerType>
+	class Snapshot
+	{
+	public:
+		Snapshot();
+		explicit Snapshot(ContainerType container);
+		Snapshot(const Snapshot<ContainerType>& copy) = delete;
+		~Snapshot();
+
+		auto operator=(const Snapshot<ContainerType>& copy) -> Snapshot<ContainerType>& = delete;
+
+		auto Acquire() const -> std::shared_ptr<const ContainerType>;
+		auto Version() const -> unsigned long long;
+
+		void Publish(ContainerType container);
+		void Update(FunctionView<void(ContainerType&)> update);
+
+	private:
+		std::atomic<std::shared_ptr<const ContainerType>*> _current;
+		std::atomic<unsigned int> _epoch = 0;
+		mutable std::atomic<int> _readers[2] = {};
+		std::atomic<unsigned long long> _version = 0;
+		std::mutex _writer;
+
+		void Store(std::shared_ptr<const ContainerType>&& container);
+	};
+
+	template<typename ItemType> using SnapshotList = Snapshot<PersistentList<ItemType>>;
+	template<typename KeyType, typename ItemType> using SnapshotMap = Snapshot<PersistentMap<KeyType, ItemType>>;
+}
+
+template<typename ContainerType>
+Pargon::Snapshot<ContainerType>::Snapshot() :
+	_current(new std::shared_ptr<const ContainerType>(std::make_shared<const ContainerType>()))
+{
+}
+
+template<typename ContainerType>
+Pargon::Snapshot<ContainerType>::Snapshot(ContainerType container) :
+	_current(new std::shared_ptr<const ContainerType>(std::make_shared<const ContainerType>(std::move(container))))
+{
+}
+
+template<typename ContainerType>
+Pargon::Snapshot<ContainerType>::~Snapshot()
+{
+	delete _current.load(std::memory_order_relaxed);
+}
+
+template<typename ContainerType>
+auto Pargon::Snapshot<ContainerType>::Acquire() const -> std::shared_ptr<const ContainerType>
+{
+	auto epoch = _epoch.load();
+
+	while (true)
+	{
+		_readers[epoch & 1].fetch_add(1);
+
+		auto current = _epoch.load();
+
+		if (current == epoch)
+			break;
+
+		_readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+		epoch = current;
+	}
+
+	auto container = *_current.load();
+	_readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+	return container;
+}
+
+template<typename ContainerType>
+auto Pargon::Snapshot<ContainerType>::Version() const -> unsigned long long
+{
+	return _version.load(std::memory_order_acquire);
+}
+
+template<typename ContainerType>
+void Pargon::Snapshot<ContainerType>::Publish(ContainerType container)
+{
+	std::lock_guard<std::mutex> lock(_writer);
+	Store(std::make_shared<const ContainerType>(std::move(container)));
+}
+
+template<typename ContainerType>
+void Pargon::Snapshot<ContainerType>::Update(FunctionView<void(ContainerType&)> update)
+{
+	std::lock_guard<std::mutex> lock(_writer);
+
+	auto next = std::make_shared<ContainerType>(**_current.load(std::memory_order_relaxed));
+	update(*next);
+
+	Store(std::move(next));
+}
+
+template<typename ContainerType>
+void Pargon::Snapshot<ContainerType>::Store(std::shared_ptr<const ContainerType>&& container)
+{
+	auto previous = _current.exchange(new std::shared_ptr<const ContainerType>(std::move(container)));
+	auto epoch = _epoch.fetch_add(1);
+
+	while (_readers[epoch & 1].load(std::memory_order_acquire) != 0)
+		std::this_thread::yield();
+
+	delete previous;
+	_version.fetch_add(1, std::memory_order_release);
+}
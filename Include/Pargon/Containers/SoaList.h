@@ -0,0 +1,218 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <cassert>
+#include <tuple>
+#include <type_traits>
+
+namespace Pargon
+{
+	template<typename... FieldTypes>
+	class SoaList
+	{
+	public:
+		template<int Index> using FieldType = std::tuple_element_t<Index, std::tuple<FieldTypes...>>;
+		using Row = std::tuple<FieldTypes&...>;
+		using ConstRow = std::tuple<const FieldTypes&...>;
+
+		static constexpr int FieldCount = sizeof...(FieldTypes);
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto Capacity() const -> int;
+		auto LastIndex() const -> int;
+
+		auto Item(int index) -> Row;
+		auto Item(int index) const -> ConstRow;
+		void SetItem(int index, FieldTypes... fields);
+
+		template<int Index> auto GetView() const -> SequenceView<FieldType<Index>>;
+		template<int Index> auto GetReference() -> SequenceReference<FieldType<Index>>;
+
+		void SetCount(int count);
+		void EnsureCapacity(int capacity);
+
+		auto Add(FieldTypes... fields) -> Row;
+		auto Insert(FieldTypes... fields, int index) -> Row;
+
+		auto RemoveAt(int index) -> bool;
+		auto RemoveLast() -> bool;
+
+		void Clear();
+
+	private:
+		std::tuple<List<FieldTypes>...> _columns;
+
+		void Reserve(int count);
+	};
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::IsEmpty() const -> bool
+{
+	return Count() == 0;
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::Count() const -> int
+{
+	return std::get<0>(_columns).Count();
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::Capacity() const -> int
+{
+	return std::get<0>(_columns).Capacity();
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::LastIndex() const -> int
+{
+	return Count() - 1;
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::Item(int index) -> Row
+{
+	assert(index >= 0 && index < Count());
+	return std::apply([index](auto&... columns) { return Row(columns.Item(index)...); }, _columns);
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::Item(int index) const -> ConstRow
+{
+	assert(index >= 0 && index < Count());
+	return std::apply([index](auto&... columns) { return ConstRow(columns.Item(index)...); }, _columns);
+}
+
+template<typename... FieldTypes>
+void Pargon::SoaList<FieldTypes...>::SetItem(int index, FieldTypes... fields)
+{
+	assert(index >= 0 && index < Count());
+
+	if constexpr ((std::is_nothrow_move_assignable<FieldTypes>::value && ...))
+	{
+		std::apply([&](auto&... columns) { (columns.SetItem(index, std::move(fields)), ...); }, _columns);
+	}
+	else
+	{
+		std::tuple<FieldTypes...> previous(Item(index));
+		auto set = 0;
+
+		try
+		{
+			std::apply([&](auto&... columns) { ((columns.SetItem(index, std::move(fields)), set++), ...); }, _columns);
+		}
+		catch (...)
+		{
+			std::apply([&](auto&... values) { std::apply([&](auto&... columns) { auto column = 0; ((column++ < set ? columns.SetItem(index, std::move(values)) : void()), ...); }, _columns); }, previous);
+			throw;
+		}
+	}
+}
+
+template<typename... FieldTypes>
+template<int Index>
+auto Pargon::SoaList<FieldTypes...>::GetView() const -> SequenceView<FieldType<Index>>
+{
+	return std::get<Index>(_columns).GetView();
+}
+
+template<typename... FieldTypes>
+template<int Index>
+auto Pargon::SoaList<FieldTypes...>::GetReference() -> SequenceReference<FieldType<Index>>
+{
+	return std::get<Index>(_columns).GetReference();
+}
+
+template<typename... FieldTypes>
+void Pargon::SoaList<FieldTypes...>::SetCount(int count)
+{
+	std::apply([count](auto&... columns) { (columns.SetCount(count), ...); }, _columns);
+}
+
+template<typename... FieldTypes>
+void Pargon::SoaList<FieldTypes...>::EnsureCapacity(int capacity)
+{
+	std::apply([capacity](auto&... columns) { (columns.EnsureCapacity(capacity), ...); }, _columns);
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::Add(FieldTypes... fields) -> Row
+{
+	Reserve(Count() + 1);
+
+	auto added = 0;
+
+	try
+	{
+		std::apply([&](auto&... columns) { ((columns.Add(std::move(fields)), added++), ...); }, _columns);
+	}
+	catch (...)
+	{
+		std::apply([added](auto&... columns) { auto column = 0; ((column++ < added ? columns.RemoveLast() : false), ...); }, _columns);
+		throw;
+	}
+
+	return Item(LastIndex());
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::Insert(FieldTypes... fields, int index) -> Row
+{
+	assert(index >= 0 && index <= Count());
+
+	Reserve(Count() + 1);
+
+	auto inserted = 0;
+
+	try
+	{
+		std::apply([&](auto&... columns) { ((columns.Insert(std::move(fields), index), inserted++), ...); }, _columns);
+	}
+	catch (...)
+	{
+		std::apply([index, inserted](auto&... columns) { auto column = 0; ((column++ < inserted ? columns.RemoveAt(index) : false), ...); }, _columns);
+		throw;
+	}
+
+	return Item(index);
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::RemoveAt(int index) -> bool
+{
+	if (index < 0 || index >= Count())
+		return false;
+
+	std::apply([index](auto&... columns) { (columns.RemoveAt(index), ...); }, _columns);
+	return true;
+}
+
+template<typename... FieldTypes>
+auto Pargon::SoaList<FieldTypes...>::RemoveLast() -> bool
+{
+	return RemoveAt(LastIndex());
+}
+
+template<typename... FieldTypes>
+void Pargon::SoaList<FieldTypes...>::Clear()
+{
+	std::apply([](auto&... columns) { (columns.Clear(), ...); }, _columns);
+}
+
+template<typename... FieldTypes>
+void Pargon::SoaList<FieldTypes...>::Reserve(int count)
+{
+	auto reserve = [count](auto& column)
+	{
+		auto capacity = column.Capacity();
+
+		if (count > capacity)
+			column.EnsureCapacity(count > capacity + capacity / 2 ? count : capacity + capacity / 2);
+	};
+
+	std::apply([&](auto&... columns) { (reserve(columns), ...); }, _columns);
+}
@@ -0,0 +1,561 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Pargon
+{
+	class Sorting
+	{
+	public:
+		template<typename ItemType, typename ComparerType> static void PatternDefeating(ItemType* begin, ItemType* end, ComparerType comparer);
+		template<typename ItemType> static void Radix(ItemType* items, int count);
+		template<typename ItemType, typename KeyFunctionType> static void Radix(ItemType* items, int count, KeyFunctionType key);
+
+	private:
+		static constexpr int InsertionSortThreshold = 24;
+		static constexpr int NintherThreshold = 128;
+		static constexpr int PartialInsertionSortLimit = 8;
+		static constexpr int BlockSize = 64;
+		static constexpr int CachelineSize = 64;
+		static constexpr int RadixThreshold = 256;
+
+		template<int Size> struct RadixKeyType;
+
+		template<typename ItemType, typename ComparerType> static void InsertionSort(ItemType* begin, ItemType* end, ComparerType& comparer);
+		template<typename ItemType, typename ComparerType> static void UnguardedInsertionSort(ItemType* begin, ItemType* end, ComparerType& comparer);
+		template<typename ItemType, typename ComparerType> static auto PartialInsertionSort(ItemType* begin, ItemType* end, ComparerType& comparer) -> bool;
+		template<typename ItemType, typename ComparerType> static void Sort2(ItemType* a, ItemType* b, ComparerType& comparer);
+		template<typename ItemType, typename ComparerType> static void Sort3(ItemType* a, ItemType* b, ItemType* c, ComparerType& comparer);
+		template<typename ItemType> static void SwapOffsets(ItemType* first, ItemType* last, const unsigned char* leftOffsets, const unsigned char* rightOffsets, int count, bool useSwaps);
+		template<typename ItemType, typename ComparerType> static auto PartitionRight(ItemType* begin, ItemType* end, ComparerType& comparer, bool& alreadyPartitioned) -> ItemType*;
+		template<typename ItemType, typename ComparerType> static auto PartitionRightBranchless(ItemType* begin, ItemType* end, ComparerType& comparer, bool& alreadyPartitioned) -> ItemType*;
+		template<typename ItemType, typename ComparerType> static auto PartitionLeft(ItemType* begin, ItemType* end, ComparerType& comparer) -> ItemType*;
+		template<bool Branchless, typename ItemType, typename ComparerType> static void PatternDefeatingLoop(ItemType* begin, ItemType* end, ComparerType& comparer, int badAllowed, bool leftmost);
+
+		template<typename KeyType> static auto RadixKey(KeyType key);
+		template<typename ItemType, typename KeyFunctionType> static void RadixPasses(ItemType* items, ItemType* scratch, int count, KeyFunctionType key);
+	};
+}
+
+template<> struct Pargon::Sorting::RadixKeyType<1> { using Type = uint8_t; };
+template<> struct Pargon::Sorting::RadixKeyType<2> { using Type = uint16_t; };
+template<> struct Pargon::Sorting::RadixKeyType<4> { using Type = uint32_t; };
+template<> struct Pargon::Sorting::RadixKeyType<8> { using Type = uint64_t; };
+
+template<typename ItemType, typename ComparerType>
+void Pargon::Sorting::PatternDefeating(ItemType* begin, ItemType* end, ComparerType comparer)
+{
+	if (end - begin < 2)
+		return;
+
+	auto badAllowed = 0;
+	for (auto size = end - begin; size > 1; size >>= 1)
+		badAllowed++;
+
+	constexpr auto branchless = std::is_arithmetic<ItemType>::value && (std::is_same<ComparerType, std::less<ItemType>>::value || std::is_same<ComparerType, std::less<>>::value);
+	PatternDefeatingLoop<branchless>(begin, end, comparer, badAllowed, true);
+}
+
+template<typename ItemType>
+void Pargon::Sorting::Radix(ItemType* items, int count)
+{
+	static_assert(std::is_arithmetic<ItemType>::value && sizeof(ItemType) <= 8, "RadixSort requires an integer or floating point ItemType");
+
+	if (count < RadixThreshold)
+	{
+		PatternDefeating(items, items + count, std::less<ItemType>());
+		return;
+	}
+
+	std::unique_ptr<ItemType[]> scratch(new ItemType[count]);
+	RadixPasses(items, scratch.get(), count, [](ItemType item) { return RadixKey(item); });
+}
+
+template<typename ItemType, typename KeyFunctionType>
+void Pargon::Sorting::Radix(ItemType* items, int count, KeyFunctionType key)
+{
+	using KeyType = std::decay_t<decltype(key(*items))>;
+	static_assert(std::is_arithmetic<KeyType>::value && sizeof(KeyType) <= 8, "RadixSort requires a key function returning an integer or floating point value");
+
+	if (count < RadixThreshold)
+	{
+		std::stable_sort(items, items + count, [&key](const ItemType& left, const ItemType& right) { return key(left) < key(right); });
+		return;
+	}
+
+	struct Entry
+	{
+		typename RadixKeyType<sizeof(KeyType)>::Type Key;
+		int Index;
+	};
+
+	std::unique_ptr<Entry[]> entries(new Entry[count]);
+	std::unique_ptr<Entry[]> scratch(new Entry[count]);
+
+	for (auto i = 0; i < count; i++)
+		entries[i] = { RadixKey(static_cast<KeyType>(key(items[i]))), i };
+
+	RadixPasses(entries.get(), scratch.get(), count, [](const Entry& entry) { return entry.Key; });
+
+	auto sorted = static_cast<ItemType*>(::operator new(sizeof(ItemType) * count, std::align_val_t(alignof(ItemType))));
+
+	for (auto i = 0; i < count; i++)
+		::new(static_cast<void*>(sorted + i)) ItemType(std::move(items[entries[i].Index]));
+
+	std::move(sorted, sorted + count, items);
+	std::destroy(sorted, sorted + count);
+	::operator delete(sorted, std::align_val_t(alignof(ItemType)));
+}
+
+template<typename ItemType, typename ComparerType>
+void Pargon::Sorting::InsertionSort(ItemType* begin, ItemType* end, ComparerType& comparer)
+{
+	if (begin == end)
+		return;
+
+	for (auto current = begin + 1; current != end; current++)
+	{
+		auto sift = current;
+		auto previous = current - 1;
+
+		if (comparer(*sift, *previous))
+		{
+			ItemType item(std::move(*sift));
+
+			do
+			{
+				*sift-- = std::move(*previous);
+			}
+			while (sift != begin && comparer(item, *--previous));
+
+			*sift = std::move(item);
+		}
+	}
+}
+
+template<typename ItemType, typename ComparerType>
+void Pargon::Sorting::UnguardedInsertionSort(ItemType* begin, ItemType* end, ComparerType& comparer)
+{
+	if (begin == end)
+		return;
+
+	for (auto current = begin + 1; current != end; current++)
+	{
+		auto sift = current;
+		auto previous = current - 1;
+
+		if (comparer(*sift, *previous))
+		{
+			ItemType item(std::move(*sift));
+
+			do
+			{
+				*sift-- = std::move(*previous);
+			}
+			while (comparer(item, *--previous));
+
+			*sift = std::move(item);
+		}
+	}
+}
+
+template<typename ItemType, typename ComparerType>
+auto Pargon::Sorting::PartialInsertionSort(ItemType* begin, ItemType* end, ComparerType& comparer) -> bool
+{
+	if (begin == end)
+		return true;
+
+	auto moved = 0;
+
+	for (auto current = begin + 1; current != end; current++)
+	{
+		auto sift = current;
+		auto previous = current - 1;
+
+		if (comparer(*sift, *previous))
+		{
+			ItemType item(std::move(*sift));
+
+			do
+			{
+				*sift-- = std::move(*previous);
+			}
+			while (sift != begin && comparer(item, *--previous));
+
+			*sift = std::move(item);
+			moved += static_cast<int>(current - sift);
+		}
+
+		if (moved > PartialInsertionSortLimit)
+			return false;
+	}
+
+	return true;
+}
+
+template<typename ItemType, typename ComparerType>
+void Pargon::Sorting::Sort2(ItemType* a, ItemType* b, ComparerType& comparer)
+{
+	if (comparer(*b, *a))
+		std::iter_swap(a, b);
+}
+
+template<typename ItemType, typename ComparerType>
+void Pargon::Sorting::Sort3(ItemType* a, ItemType* b, ItemType* c, ComparerType& comparer)
+{
+	Sort2(a, b, comparer);
+	Sort2(b, c, comparer);
+	Sort2(a, b, comparer);
+}
+
+template<typename ItemType>
+void Pargon::Sorting::SwapOffsets(ItemType* first, ItemType* last, const unsigned char* leftOffsets, const unsigned char* rightOffsets, int count, bool useSwaps)
+{
+	if (useSwaps)
+	{
+		for (auto i = 0; i < count; i++)
+			std::iter_swap(first + leftOffsets[i], last - rightOffsets[i]);
+	}
+	else if (count > 0)
+	{
+		auto left = first + leftOffsets[0];
+		auto right = last - rightOffsets[0];
+
+		ItemType item(std::move(*left));
+		*left = std::move(*right);
+
+		for (auto i = 1; i < count; i++)
+		{
+			left = first + leftOffsets[i];
+			*right = std::move(*left);
+			right = last - rightOffsets[i];
+			*left = std::move(*right);
+		}
+
+		*right = std::move(item);
+	}
+}
+
+template<typename ItemType, typename ComparerType>
+auto Pargon::Sorting::PartitionRight(ItemType* begin, ItemType* end, ComparerType& comparer, bool& alreadyPartitioned) -> ItemType*
+{
+	ItemType pivot(std::move(*begin));
+	auto first = begin;
+	auto last = end;
+
+	while (comparer(*++first, pivot));
+
+	if (first - 1 == begin)
+		while (first < last && !comparer(*--last, pivot));
+	else
+		while (!comparer(*--last, pivot));
+
+	alreadyPartitioned = first >= last;
+
+	while (first < last)
+	{
+		std::iter_swap(first, last);
+		while (comparer(*++first, pivot));
+		while (!comparer(*--last, pivot));
+	}
+
+	auto pivotPosition = first - 1;
+	*begin = std::move(*pivotPosition);
+	*pivotPosition = std::move(pivot);
+	return pivotPosition;
+}
+
+template<typename ItemType, typename ComparerType>
+auto Pargon::Sorting::PartitionRightBranchless(ItemType* begin, ItemType* end, ComparerType& comparer, bool& alreadyPartitioned) -> ItemType*
+{
+	ItemType pivot(std::move(*begin));
+	auto first = begin;
+	auto last = end;
+
+	while (comparer(*++first, pivot));
+
+	if (first - 1 == begin)
+		while (first < last && !comparer(*--last, pivot));
+	else
+		while (!comparer(*--last, pivot));
+
+	alreadyPartitioned = first >= last;
+
+	if (!alreadyPartitioned)
+	{
+		std::iter_swap(first, last);
+		first++;
+
+		alignas(CachelineSize) unsigned char leftOffsets[BlockSize];
+		alignas(CachelineSize) unsigned char rightOffsets[BlockSize];
+
+		auto leftBase = first;
+		auto rightBase = last;
+		auto leftCount = 0;
+		auto rightCount = 0;
+		auto leftStart = 0;
+		auto rightStart = 0;
+
+		while (first < last)
+		{
+			auto unknown = static_cast<int>(last - first);
+			auto leftSplit = leftCount == 0 ? (rightCount == 0 ? unknown / 2 : unknown) : 0;
+			auto rightSplit = rightCount == 0 ? unknown - leftSplit : 0;
+
+			if (leftSplit > BlockSize)
+				leftSplit = BlockSize;
+
+			if (rightSplit > BlockSize)
+				rightSplit = BlockSize;
+
+			for (auto i = 0; i < leftSplit; i++)
+			{
+				leftOffsets[leftCount] = static_cast<unsigned char>(i);
+				leftCount += !comparer(*first, pivot);
+				first++;
+			}
+
+			for (auto i = 0; i < rightSplit; i++)
+			{
+				rightOffsets[rightCount] = static_cast<unsigned char>(i + 1);
+				rightCount += comparer(*--last, pivot);
+			}
+
+			auto count = std::min(leftCount, rightCount);
+			SwapOffsets(leftBase, rightBase, leftOffsets + leftStart, rightOffsets + rightStart, count, leftCount == rightCount);
+			leftCount -= count;
+			rightCount -= count;
+			leftStart += count;
+			rightStart += count;
+
+			if (leftCount == 0)
+			{
+				leftStart = 0;
+				leftBase = first;
+			}
+
+			if (rightCount == 0)
+			{
+				rightStart = 0;
+				rightBase = last;
+			}
+		}
+
+		if (leftCount > 0)
+		{
+			while (leftCount--)
+				std::iter_swap(leftBase + leftOffsets[leftStart + leftCount], --last);
+
+			first = last;
+		}
+
+		if (rightCount > 0)
+		{
+			while (rightCount--)
+				std::iter_swap(rightBase - rightOffsets[rightStart + rightCount], first++);
+
+			last = first;
+		}
+	}
+
+	auto pivotPosition = first - 1;
+	*begin = std::move(*pivotPosition);
+	*pivotPosition = std::move(pivot);
+	return pivotPosition;
+}
+
+template<typename ItemType, typename ComparerType>
+auto Pargon::Sorting::PartitionLeft(ItemType* begin, ItemType* end, ComparerType& comparer) -> ItemType*
+{
+	ItemType pivot(std::move(*begin));
+	auto first = begin;
+	auto last = end;
+
+	while (comparer(pivot, *--last));
+
+	if (last + 1 == end)
+		while (first < last && !comparer(pivot, *++first));
+	else
+		while (!comparer(pivot, *++first));
+
+	while (first < last)
+	{
+		std::iter_swap(first, last);
+		while (comparer(pivot, *--last));
+		while (!comparer(pivot, *++first));
+	}
+
+	auto pivotPosition = last;
+	*begin = std::move(*pivotPosition);
+	*pivotPosition = std::move(pivot);
+	return pivotPosition;
+}
+
+template<bool Branchless, typename ItemType, typename ComparerType>
+void Pargon::Sorting::PatternDefeatingLoop(ItemType* begin, ItemType* end, ComparerType& comparer, int badAllowed, bool leftmost)
+{
+	while (true)
+	{
+		auto size = static_cast<int>(end - begin);
+
+		if (size < InsertionSortThreshold)
+		{
+			if (leftmost)
+				InsertionSort(begin, end, comparer);
+			else
+				UnguardedInsertionSort(begin, end, comparer);
+
+			return;
+		}
+
+		auto half = size / 2;
+
+		if (size > NintherThreshold)
+		{
+			Sort3(begin, begin + half, end - 1, comparer);
+			Sort3(begin + 1, begin + (half - 1), end - 2, comparer);
+			Sort3(begin + 2, begin + (half + 1), end - 3, comparer);
+			Sort3(begin + (half - 1), begin + half, begin + (half + 1), comparer);
+			std::iter_swap(begin, begin + half);
+		}
+		else
+		{
+			Sort3(begin + half, begin, end - 1, comparer);
+		}
+
+		if (!leftmost && !comparer(*(begin - 1), *begin))
+		{
+			begin = PartitionLeft(begin, end, comparer) + 1;
+			continue;
+		}
+
+		auto alreadyPartitioned = false;
+		auto pivotPosition = Branchless ? PartitionRightBranchless(begin, end, comparer, alreadyPartitioned) : PartitionRight(begin, end, comparer, alreadyPartitioned);
+
+		auto leftSize = static_cast<int>(pivotPosition - begin);
+		auto rightSize = static_cast<int>(end - (pivotPosition + 1));
+		auto unbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+		if (unbalanced)
+		{
+			if (--badAllowed == 0)
+			{
+				std::make_heap(begin, end, comparer);
+				std::sort_heap(begin, end, comparer);
+				return;
+			}
+
+			if (leftSize >= InsertionSortThreshold)
+			{
+				std::iter_swap(begin, begin + leftSize / 4);
+				std::iter_swap(pivotPosition - 1, pivotPosition - leftSize / 4);
+
+				if (leftSize > NintherThreshold)
+				{
+					std::iter_swap(begin + 1, begin + (leftSize / 4 + 1));
+					std::iter_swap(begin + 2, begin + (leftSize / 4 + 2));
+					std::iter_swap(pivotPosition - 2, pivotPosition - (leftSize / 4 + 1));
+					std::iter_swap(pivotPosition - 3, pivotPosition - (leftSize / 4 + 2));
+				}
+			}
+
+			if (rightSize >= InsertionSortThreshold)
+			{
+				std::iter_swap(pivotPosition + 1, pivotPosition + (1 + rightSize / 4));
+				std::iter_swap(end - 1, end - rightSize / 4);
+
+				if (rightSize > NintherThreshold)
+				{
+					std::iter_swap(pivotPosition + 2, pivotPosition + (2 + rightSize / 4));
+					std::iter_swap(pivotPosition + 3, pivotPosition + (3 + rightSize / 4));
+					std::iter_swap(end - 2, end - (1 + rightSize / 4));
+					std::iter_swap(end - 3, end - (2 + rightSize / 4));
+				}
+			}
+		}
+		else if (alreadyPartitioned && PartialInsertionSort(begin, pivotPosition, comparer) && PartialInsertionSort(pivotPosition + 1, end, comparer))
+		{
+			return;
+		}
+
+		PatternDefeatingLoop<Branchless>(begin, pivotPosition, comparer, badAllowed, leftmost);
+		begin = pivotPosition + 1;
+		leftmost = false;
+	}
+}
+
+template<typename KeyType>
+auto Pargon::Sorting::RadixKey(KeyType key)
+{
+	using UnsignedType = typename RadixKeyType<sizeof(KeyType)>::Type;
+	constexpr auto signBit = static_cast<UnsignedType>(UnsignedType(1) << (sizeof(KeyType) * 8 - 1));
+
+	if constexpr (std::is_floating_point<KeyType>::value)
+	{
+		UnsignedType bits;
+		std::memcpy(&bits, &key, sizeof(KeyType));
+		return static_cast<UnsignedType>((bits & signBit) ? ~bits : bits | signBit);
+	}
+	else if constexpr (std::is_signed<KeyType>::value)
+	{
+		return static_cast<UnsignedType>(static_cast<UnsignedType>(key) ^ signBit);
+	}
+	else
+	{
+		return static_cast<UnsignedType>(key);
+	}
+}
+
+template<typename ItemType, typename KeyFunctionType>
+void Pargon::Sorting::RadixPasses(ItemType* items, ItemType* scratch, int count, KeyFunctionType key)
+{
+	using KeyType = std::decay_t<decltype(key(*items))>;
+	constexpr auto passes = static_cast<int>(sizeof(KeyType));
+
+	int histograms[passes][256] = {};
+
+	for (auto i = 0; i < count; i++)
+	{
+		auto itemKey = key(items[i]);
+
+		for (auto pass = 0; pass < passes; pass++)
+			histograms[pass][(itemKey >> (pass * 8)) & 0xFF]++;
+	}
+
+	auto from = items;
+	auto to = scratch;
+
+	for (auto pass = 0; pass < passes; pass++)
+	{
+		auto& histogram = histograms[pass];
+		auto shift = pass * 8;
+
+		if (histogram[(key(from[0]) >> shift) & 0xFF] == count)
+			continue;
+
+		int offsets[256];
+		auto offset = 0;
+
+		for (auto digit = 0; digit < 256; digit++)
+		{
+			offsets[digit] = offset;
+			offset += histogram[digit];
+		}
+
+		for (auto i = 0; i < count; i++)
+			to[offsets[(key(from[i]) >> shift) & 0xFF]++] = std::move(from[i]);
+
+		std::swap(from, to);
+	}
+
+	if (from != items)
+		std::move(from, from + count, items);
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "Pargon/Containers/Array.h"
+#include "Pargon/Containers/ArrayMath.h"
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+namespace Pargon
+{
+	class SortingNetworks
+	{
+	public:
+		static constexpr int MaximumSize = 32;
+
+		template<typename ItemType, int N, int Alignment> static constexpr void Sort(Array<ItemType, N, Alignment>& array);
+		template<int K, typename ItemType, int N, int Alignment> static constexpr auto Select(Array<ItemType, N, Alignment> array) -> ItemType;
+		template<typename ItemType, int N, int Alignment> static constexpr auto Median(const Array<ItemType, N, Alignment>& array) -> ItemType;
+
+		template<int N> static constexpr auto ComparatorCount() -> int;
+		template<int N, int K> static constexpr auto SelectionComparatorCount() -> int;
+
+	private:
+		struct Comparator
+		{
+			int First;
+			int Second;
+		};
+
+		template<typename> struct IsArray : std::false_type {};
+		template<typename ItemType, int N, int Alignment> struct IsArray<Array<ItemType, N, Alignment>> : std::true_type {};
+
+		template<typename ActionType> static constexpr void Generate(int size, ActionType action);
+		template<int N> static constexpr auto BuildNetwork() -> std::array<Comparator, ComparatorCount<N>()>;
+		template<int N, int K> static constexpr auto BuildSelection() -> std::array<Comparator, SelectionComparatorCount<N, K>()>;
+
+		template<int N> static constexpr std::array<Comparator, ComparatorCount<N>()> Network = BuildNetwork<N>();
+		template<int N, int K> static constexpr std::array<Comparator, SelectionComparatorCount<N, K>()> Selection = BuildSelection<N, K>();
+
+		template<typename ItemType> static constexpr void CompareExchange(ItemType& first, ItemType& second);
+		template<typename ItemType, std::size_t Count, std::size_t... Indices> static constexpr void Apply(ItemType* items, const std::array<Comparator, Count>& comparators, std::index_sequence<Indices...>);
+	};
+}
+
+template<typename ItemType, int N, int Alignment>
+constexpr void Pargon::SortingNetworks::Sort(Array<ItemType, N, Alignment>& array)
+{
+	static_assert(N <= MaximumSize, "SortingNetworks only supports Arrays of up to MaximumSize items");
+
+	Apply(array.begin(), Network<N>, std::make_index_sequence<Network<N>.size()>());
+}
+
+template<int K, typename ItemType, int N, int Alignment>
+constexpr auto Pargon::SortingNetworks::Select(Array<ItemType, N, Alignment> array) -> ItemType
+{
+	static_assert(N <= MaximumSize, "SortingNetworks only supports Arrays of up to MaximumSize items");
+	static_assert(K >= 0 && K < N, "Select requires K to be an index into the Array");
+
+	Apply(array.begin(), Selection<N, K>, std::make_index_sequence<Selection<N, K>.size()>());
+	return array.Item(K);
+}
+
+template<typename ItemType, int N, int Alignment>
+constexpr auto Pargon::SortingNetworks::Median(const Array<ItemType, N, Alignment>& array) -> ItemType
+{
+	return Select<N / 2>(array);
+}
+
+template<int N>
+constexpr auto Pargon::SortingNetworks::ComparatorCount() -> int
+{
+	auto count = 0;
+	Generate(N, [&count](int, int) { count++; });
+	return count;
+}
+
+template<int N, int K>
+constexpr auto Pargon::SortingNetworks::SelectionComparatorCount() -> int
+{
+	bool needed[N > 0 ? N : 1] = {};
+	needed[K] = true;
+
+	auto count = 0;
+
+	for (auto i = static_cast<int>(Network<N>.size()) - 1; i >= 0; i--)
+	{
+		auto& comparator = Network<N>[i];
+
+		if (needed[comparator.First] || needed[comparator.Second])
+		{
+			needed[comparator.First] = true;
+			needed[comparator.Second] = true;
+			count++;
+		}
+	}
+
+	return count;
+}
+
+template<typename ActionType>
+constexpr void Pargon::SortingNetworks::Generate(int size, ActionType action)
+{
+	for (auto p = 1; p < size; p *= 2)
+	{
+		for (auto k = p; k >= 1; k /= 2)
+		{
+			for (auto j = k % p; j + k < size; j += 2 * k)
+			{
+				for (auto i = 0; i < k && i + j + k < size; i++)
+				{
+					if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+						action(i + j, i + j + k);
+				}
+			}
+		}
+	}
+}
+
+template<int N>
+constexpr auto Pargon::SortingNetworks::BuildNetwork() -> std::array<Comparator, ComparatorCount<N>()>
+{
+	std::array<Comparator, ComparatorCount<N>()> network = {};
+	auto index = 0;
+
+	Generate(N, [&network, &index](int first, int second)
+	{
+		network[index].First = first;
+		network[index].Second = second;
+		index++;
+	});
+
+	return network;
+}
+
+template<int N, int K>
+constexpr auto Pargon::SortingNetworks::BuildSelection() -> std::array<Comparator, SelectionComparatorCount<N, K>()>
+{
+	std::array<Comparator, SelectionComparatorCount<N, K>()> selection = {};
+	bool needed[N > 0 ? N : 1] = {};
+	needed[K] = true;
+
+	auto index = static_cast<int>(selection.size());
+
+	for (auto i = static_cast<int>(Network<N>.size()) - 1; i >= 0; i--)
+	{
+		auto& comparator = Network<N>[i];
+
+		if (needed[comparator.First] || needed[comparator.Second])
+		{
+			needed[comparator.First] = true;
+			needed[comparator.Second] = true;
+			index--;
+			selection[index].First = comparator.First;
+			selection[index].Second = comparator.Second;
+		}
+	}
+
+	return selection;
+}
+
+template<typename ItemType>
+constexpr void Pargon::SortingNetworks::CompareExchange(ItemType& first, ItemType& second)
+{
+	if constexpr (IsArray<ItemType>::value)
+	{
+		auto low = ArrayMath::Minimum(first, second);
+		second = ArrayMath::Maximum(first, second);
+		first = low;
+	}
+	else
+	{
+		auto swap = second < first;
+		auto low = swap ? second : first;
+		auto high = swap ? first : second;
+		first = std::move(low);
+		second = std::move(high);
+	}
+}
+
+template<typename ItemType, std::size_t Count, std::size_t... Indices>
+constexpr void Pargon::SortingNetworks::Apply(ItemType* items, const std::array<Comparator, Count>& comparators, std::index_sequence<Indices...>)
+{
+	if constexpr (Count > 0)
+		(CompareExchange(items[comparators[Indices].First], items[comparators[Indices].Second]), ...);
+}
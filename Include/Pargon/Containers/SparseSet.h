@@ -0,0 +1,311 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType>
+	class SparseSet
+	{
+	public:
+		static constexpr int PageSize = 4096;
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto LastIndex() const -> int;
+
+		auto Contains(int id) const -> bool;
+
+		auto ItemWithId(int id) -> ItemType&;
+		auto ItemWithId(int id) const -> const ItemType&;
+		auto ItemAtIndex(int index) -> ItemType&;
+		auto ItemAtIndex(int index) const -> const ItemType&;
+
+		auto Ids() const -> SequenceView<int>;
+		auto Items() const -> SequenceView<ItemType>;
+		auto Items() -> SequenceReference<ItemType>;
+		auto GetId(int index) const -> int;
+		auto GetIndex(int id) const -> int;
+
+		void EnsureCapacity(int capacity);
+
+		auto AddOrGet(int id, ItemType&& item) -> ItemType&;
+		auto AddOrGet(int id, const ItemType& item) -> ItemType&;
+		auto AddOrSet(int id, ItemType&& item) -> ItemType&;
+		auto AddOrSet(int id, const ItemType& item) -> ItemType&;
+
+		auto RemoveWithId(int id) -> bool;
+		void RemoveAtIndex(int index);
+
+		void Clear();
+
+	private:
+		List<std::unique_ptr<int[]>> _pages;
+		List<int> _ids;
+		List<ItemType> _items;
+
+		auto Slot(int id) -> int&;
+	};
+
+	class SparseSets
+	{
+	public:
+		template<typename ActionType, typename... ItemTypes> static void ForEachIntersection(ActionType action, SparseSet<ItemTypes>&... sets);
+	};
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::IsEmpty() const -> bool
+{
+	return _items.IsEmpty();
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::Count() const -> int
+{
+	return _items.Count();
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::LastIndex() const -> int
+{
+	return _items.LastIndex();
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::Contains(int id) const -> bool
+{
+	return GetIndex(id) != Sequence::InvalidIndex;
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::ItemWithId(int id) -> ItemType&
+{
+	auto index = GetIndex(id);
+	assert(index != Sequence::InvalidIndex);
+	return _items.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::ItemWithId(int id) const -> const ItemType&
+{
+	auto index = GetIndex(id);
+	assert(index != Sequence::InvalidIndex);
+	return _items.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::ItemAtIndex(int index) -> ItemType&
+{
+	return _items.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::ItemAtIndex(int index) const -> const ItemType&
+{
+	return _items.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::Ids() const -> SequenceView<int>
+{
+	return _ids.GetView();
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::Items() const -> SequenceView<ItemType>
+{
+	return _items.GetView();
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::Items() -> SequenceReference<ItemType>
+{
+	return _items.GetReference();
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::GetId(int index) const -> int
+{
+	return _ids.Item(index);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::GetIndex(int id) const -> int
+{
+	auto page = id / PageSize;
+
+	if (id < 0 || page >= _pages.Count() || _pages.Item(page) == nullptr)
+		return Sequence::InvalidIndex;
+
+	return _pages.Item(page)[id % PageSize];
+}
+
+template<typename ItemType>
+void Pargon::SparseSet<ItemType>::EnsureCapacity(int capacity)
+{
+	_ids.EnsureCapacity(capacity);
+	_items.EnsureCapacity(capacity);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::AddOrGet(int id, ItemType&& item) -> ItemType&
+{
+	auto& slot = Slot(id);
+
+	if (slot == Sequence::InvalidIndex)
+	{
+		_items.Add(std::move(item));
+		_ids.Add(id);
+		slot = _items.LastIndex();
+	}
+
+	return _items.Item(slot);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::AddOrGet(int id, const ItemType& item) -> ItemType&
+{
+	auto& slot = Slot(id);
+
+	if (slot == Sequence::InvalidIndex)
+	{
+		_items.Add(item);
+		_ids.Add(id);
+		slot = _items.LastIndex();
+	}
+
+	return _items.Item(slot);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::AddOrSet(int id, ItemType&& item) -> ItemType&
+{
+	auto& slot = Slot(id);
+
+	if (slot == Sequence::InvalidIndex)
+	{
+		_items.Add(std::move(item));
+		_ids.Add(id);
+		slot = _items.LastIndex();
+	}
+	else
+	{
+		_items.SetItem(slot, std::move(item));
+	}
+
+	return _items.Item(slot);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::AddOrSet(int id, const ItemType& item) -> ItemType&
+{
+	auto& slot = Slot(id);
+
+	if (slot == Sequence::InvalidIndex)
+	{
+		_items.Add(item);
+		_ids.Add(id);
+		slot = _items.LastIndex();
+	}
+	else
+	{
+		_items.SetItem(slot, item);
+	}
+
+	return _items.Item(slot);
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::RemoveWithId(int id) -> bool
+{
+	auto index = GetIndex(id);
+
+	if (index == Sequence::InvalidIndex)
+		return false;
+
+	RemoveAtIndex(index);
+	return true;
+}
+
+template<typename ItemType>
+void Pargon::SparseSet<ItemType>::RemoveAtIndex(int index)
+{
+	assert(index >= 0 && index < _items.Count());
+
+	auto id = _ids.Item(index);
+	auto last = _items.LastIndex();
+
+	if (index != last)
+	{
+		_items.SetItem(index, std::move(_items.Item(last)));
+		_ids.SetItem(index, _ids.Item(last));
+		Slot(_ids.Item(index)) = index;
+	}
+
+	_items.RemoveLast();
+	_ids.RemoveLast();
+	Slot(id) = Sequence::InvalidIndex;
+}
+
+template<typename ItemType>
+void Pargon::SparseSet<ItemType>::Clear()
+{
+	for (auto id : _ids)
+		Slot(id) = Sequence::InvalidIndex;
+
+	_ids.Clear();
+	_items.Clear();
+}
+
+template<typename ItemType>
+auto Pargon::SparseSet<ItemType>::Slot(int id) -> int&
+{
+	assert(id >= 0);
+
+	auto page = id / PageSize;
+
+	if (page >= _pages.Count())
+		_pages.SetCount(page + 1);
+
+	auto& entries = _pages.Item(page);
+
+	if (entries == nullptr)
+	{
+		entries = std::make_unique<int[]>(PageSize);
+		std::fill(entries.get(), entries.get() + PageSize, Sequence::InvalidIndex);
+	}
+
+	return entries[id % PageSize];
+}
+
+template<typename ActionType, typename... ItemTypes>
+void Pargon::SparseSets::ForEachIntersection(ActionType action, SparseSet<ItemTypes>&... sets)
+{
+	static_assert(sizeof...(ItemTypes) > 0, "ForEachIntersection requires at least one set");
+
+	SequenceView<int> smallest;
+	auto first = true;
+
+	for (auto ids : { sets.Ids()... })
+	{
+		if (first || ids.Count() < smallest.Count())
+			smallest = ids;
+
+		first = false;
+	}
+
+	for (auto i = smallest.Count() - 1; i >= 0; i--)
+	{
+		auto id = smallest.Item(i);
+
+		if ((sets.Contains(id) && ...))
+			action(id, sets.ItemWithId(id)...);
+	}
+}
@@ -0,0 +1,290 @@
+#pragma once
+
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <cassert>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Pargon
+{
+	template<typename ItemType, int ChunkSize = 1024>
+	class StableList
+	{
+	public:
+		static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+
+		StableList() = default;
+		StableList(const StableList<ItemType, ChunkSize>& copy);
+		StableList(StableList<ItemType, ChunkSize>&& move);
+		~StableList();
+
+		auto operator=(const StableList<ItemType, ChunkSize>& copy) -> StableList<ItemType, ChunkSize>&;
+		auto operator=(StableList<ItemType, ChunkSize>&& move) -> StableList<ItemType, ChunkSize>&;
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto Capacity() const -> int;
+		auto LastIndex() const -> int;
+
+		auto First() -> ItemType&;
+		auto First() const -> const ItemType&;
+		auto Last() -> ItemType&;
+		auto Last() const -> const ItemType&;
+		auto Item(int index) -> ItemType&;
+		auto Item(int index) const -> const ItemType&;
+		void SetItem(int index, ItemType&& value);
+		void SetItem(int index, const ItemType& value);
+
+		auto ChunkCount() const -> int;
+		auto GetChunkView(int chunk) const -> SequenceView<ItemType>;
+		auto GetChunkReference(int chunk) -> SequenceReference<ItemType>;
+
+		void EnsureCapacity(int capacity);
+
+		auto Add(ItemType&& item) -> ItemType&;
+		auto Add(const ItemType& item) -> ItemType&;
+		template<typename... ConstructorParameterTypes> auto Increment(ConstructorParameterTypes&&... constructorParameters) -> ItemType&;
+
+		auto RemoveLast() -> bool;
+
+		void Clear();
+
+	private:
+		static constexpr int ChunkMask = ChunkSize - 1;
+
+		List<ItemType*> _chunks;
+		int _count = 0;
+
+		static auto ChunkOf(int index) -> int;
+		void Release();
+	};
+}
+
+template<typename ItemType, int ChunkSize>
+Pargon::StableList<ItemType, ChunkSize>::StableList(const StableList<ItemType, ChunkSize>& copy)
+{
+	EnsureCapacity(copy._count);
+
+	for (auto i = 0; i < copy._count; i++)
+		Add(copy.Item(i));
+}
+
+template<typename ItemType, int ChunkSize>
+Pargon::StableList<ItemType, ChunkSize>::StableList(StableList<ItemType, ChunkSize>&& move) :
+	_chunks(std::move(move._chunks)),
+	_count(move._count)
+{
+	move._count = 0;
+}
+
+template<typename ItemType, int ChunkSize>
+Pargon::StableList<ItemType, ChunkSize>::~StableList()
+{
+	Release();
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::operator=(const StableList<ItemType, ChunkSize>& copy) -> StableList<ItemType, ChunkSize>&
+{
+	if (this != &copy)
+	{
+		Clear();
+		EnsureCapacity(copy._count);
+
+		for (auto i = 0; i < copy._count; i++)
+			Add(copy.Item(i));
+	}
+
+	return *this;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::operator=(StableList<ItemType, ChunkSize>&& move) -> StableList<ItemType, ChunkSize>&
+{
+	if (this != &move)
+	{
+		Release();
+
+		_chunks = std::move(move._chunks);
+		_count = move._count;
+
+		move._count = 0;
+	}
+
+	return *this;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::IsEmpty() const -> bool
+{
+	return _count == 0;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::Count() const -> int
+{
+	return _count;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::Capacity() const -> int
+{
+	return _chunks.Count() * ChunkSize;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::LastIndex() const -> int
+{
+	return _count - 1;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::First() -> ItemType&
+{
+	return Item(0);
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::First() const -> const ItemType&
+{
+	return Item(0);
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::Last() -> ItemType&
+{
+	return Item(_count - 1);
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::Last() const -> const ItemType&
+{
+	return Item(_count - 1);
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::Item(int index) -> ItemType&
+{
+	assert(index >= 0 && index < _count);
+	return _chunks.Item(ChunkOf(index))[index & ChunkMask];
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::Item(int index) const -> const ItemType&
+{
+	assert(index >= 0 && index < _count);
+	return _chunks.Item(ChunkOf(index))[index & ChunkMask];
+}
+
+template<typename ItemType, int ChunkSize>
+void Pargon::StableList<ItemType, ChunkSize>::SetItem(int index, ItemType&& value)
+{
+	Item(index) = std::move(value);
+}
+
+template<typename ItemType, int ChunkSize>
+void Pargon::StableList<ItemType, ChunkSize>::SetItem(int index, const ItemType& value)
+{
+	Item(index) = value;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::ChunkCount() const -> int
+{
+	return ChunkOf(_count + ChunkMask);
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::GetChunkView(int chunk) const -> SequenceView<ItemType>
+{
+	assert(chunk >= 0 && chunk < ChunkCount());
+
+	auto count = _count - chunk * ChunkSize;
+	return SequenceView<ItemType>(_chunks.Item(chunk), count < ChunkSize ? count : ChunkSize);
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::GetChunkReference(int chunk) -> SequenceReference<ItemType>
+{
+	assert(chunk >= 0 && chunk < ChunkCount());
+
+	auto count = _count - chunk * ChunkSize;
+	return SequenceReference<ItemType>(_chunks.Item(chunk), count < ChunkSize ? count : ChunkSize);
+}
+
+template<typename ItemType, int ChunkSize>
+void Pargon::StableList<ItemType, ChunkSize>::EnsureCapacity(int capacity)
+{
+	auto chunks = ChunkOf(capacity + ChunkMask);
+
+	while (_chunks.Count() < chunks)
+		_chunks.Add(static_cast<ItemType*>(::operator new(sizeof(ItemType) * ChunkSize, std::align_val_t(alignof(ItemType)))));
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::Add(ItemType&& item) -> ItemType&
+{
+	return Increment(std::move(item));
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::Add(const ItemType& item) -> ItemType&
+{
+	return Increment(item);
+}
+
+template<typename ItemType, int ChunkSize>
+template<typename... ConstructorParameterTypes>
+auto Pargon::StableList<ItemType, ChunkSize>::Increment(ConstructorParameterTypes&&... constructorParameters) -> ItemType&
+{
+	EnsureCapacity(_count + 1);
+
+	auto slot = _chunks.Item(ChunkOf(_count)) + (_count & ChunkMask);
+	::new(static_cast<void*>(slot)) ItemType(std::forward<ConstructorParameterTypes>(constructorParameters)...);
+
+	_count++;
+	return *slot;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::RemoveLast() -> bool
+{
+	if (_count == 0)
+		return false;
+
+	std::destroy_at(&Item(_count - 1));
+	_count--;
+	return true;
+}
+
+template<typename ItemType, int ChunkSize>
+void Pargon::StableList<ItemType, ChunkSize>::Clear()
+{
+	for (auto chunk = 0; chunk < ChunkCount(); chunk++)
+	{
+		auto items = GetChunkReference(chunk);
+		std::destroy(items.begin(), items.end());
+	}
+
+	_count = 0;
+}
+
+template<typename ItemType, int ChunkSize>
+auto Pargon::StableList<ItemType, ChunkSize>::ChunkOf(int index) -> int
+{
+	return static_cast<int>(static_cast<unsigned int>(index) / ChunkSize);
+}
+
+template<typename ItemType, int ChunkSize>
+void Pargon::StableList<ItemType, ChunkSize>::Release()
+{
+	Clear();
+
+	for (auto chunk : _chunks)
+		::operator delete(chunk, std::align_val_t(alignof(ItemType)));
+
+	_chunks.Clear();
+}
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "Pargon/Containers/Buffer.h"
+#include "Pargon/Containers/List.h"
+#include "Pargon/Containers/Sequence.h"
+
+#include <cassert>
+#include <type_traits>
+
+namespace Pargon
+{
+	template<typename ItemType>
+	class StridedView
+	{
+	public:
+		using ValueType = std::remove_const_t<ItemType>;
+		using SequenceType = std::conditional_t<std::is_const<ItemType>::value, SequenceView<ValueType>, SequenceReference<ValueType>>;
+		using BufferType = std::conditional_t<std::is_const<ItemType>::value, BufferView, BufferReference>;
+
+		class Iterator
+		{
+		public:
+			Iterator(ItemType* item, int stride);
+
+			auto operator*() const -> ItemType&;
+			auto operator++() -> Iterator&;
+			auto operator==(const Iterator& other) const -> bool;
+			auto operator!=(const Iterator& other) const -> bool;
+
+		private:
+			ItemType* _item;
+			int _stride;
+		};
+
+		StridedView() = default;
+		StridedView(ItemType* pointer, int count, int stride = sizeof(ItemType));
+		StridedView(SequenceType sequence);
+		template<typename StructureType> StridedView(std::conditional_t<std::is_const<ItemType>::value, SequenceView<StructureType>, SequenceReference<StructureType>> structures, ItemType StructureType::* member);
+		StridedView(BufferType buffer, int offset, int stride);
+
+		auto begin() const -> Iterator;
+		auto end() const -> Iterator;
+
+		auto IsEmpty() const -> bool;
+		auto Count() const -> int;
+		auto LastIndex() const -> int;
+		auto Stride() const -> int;
+		auto IsContiguous() const -> bool;
+
+		auto First() const -> ItemType&;
+		auto Last() const -> ItemType&;
+		auto Item(int index) const -> ItemType&;
+
+		auto GetSubview(int index) const -> StridedView<ItemType>;
+		auto GetSubview(int index, int count) const -> StridedView<ItemType>;
+		auto GetSubview(int index, int count, int step) const -> StridedView<ItemType>;
+
+		template<typename ActionType> void ForEach(ActionType action) const;
+		auto ToList() const -> List<ValueType>;
+
+	private:
+		ItemType* _data = nullptr;
+		int _count = 0;
+		int _stride = sizeof(ItemType);
+
+		static auto Advance(ItemType* item, long long bytes) -> ItemType*;
+	};
+}
+
+template<typename ItemType>
+Pargon::StridedView<ItemType>::Iterator::Iterator(ItemType* item, int stride) :
+	_item(item),
+	_stride(stride)
+{
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Iterator::operator*() const -> ItemType&
+{
+	return *_item;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Iterator::operator++() -> Iterator&
+{
+	_item = Advance(_item, _stride);
+	return *this;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Iterator::operator==(const Iterator& other) const -> bool
+{
+	return _item == other._item;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Iterator::operator!=(const Iterator& other) const -> bool
+{
+	return _item != other._item;
+}
+
+template<typename ItemType>
+Pargon::StridedView<ItemType>::StridedView(ItemType* pointer, int count, int stride) :
+	_data(pointer),
+	_count(count),
+	_stride(stride)
+{
+	assert(count >= 0);
+}
+
+template<typename ItemType>
+Pargon::StridedView<ItemType>::StridedView(SequenceType sequence) :
+	_data(sequence.begin()),
+	_count(sequence.Count())
+{
+}
+
+template<typename ItemType>
+template<typename StructureType>
+Pargon::StridedView<ItemType>::StridedView(std::conditional_t<std::is_const<ItemType>::value, SequenceView<StructureType>, SequenceReference<StructureType>> structures, ItemType StructureType::* member) :
+	_data(structures.IsEmpty() ? nullptr : &(structures.begin()->*member)),
+	_count(structures.Count()),
+	_stride(sizeof(StructureType))
+{
+}
+
+template<typename ItemType>
+Pargon::StridedView<ItemType>::StridedView(BufferType buffer, int offset, int stride) :
+	_data(reinterpret_cast<ItemType*>(buffer.begin() + offset)),
+	_count(buffer.Size() - offset < static_cast<int>(sizeof(ItemType)) ? 0 : (buffer.Size() - offset - static_cast<int>(sizeof(ItemType))) / stride + 1),
+	_stride(stride)
+{
+	assert(offset >= 0 && stride > 0);
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::begin() const -> Iterator
+{
+	return { _data, _stride };
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::end() const -> Iterator
+{
+	return { Advance(_data, static_cast<long long>(_stride) * _count), _stride };
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::IsEmpty() const -> bool
+{
+	return _count == 0;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Count() const -> int
+{
+	return _count;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::LastIndex() const -> int
+{
+	return _count == 0 ? Sequence::InvalidIndex : _count - 1;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Stride() const -> int
+{
+	return _stride;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::IsContiguous() const -> bool
+{
+	return _stride == static_cast<int>(sizeof(ItemType));
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::First() const -> ItemType&
+{
+	assert(_count != 0);
+	return *_data;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Last() const -> ItemType&
+{
+	assert(_count != 0);
+	return Item(_count - 1);
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Item(int index) const -> ItemType&
+{
+	assert(index >= 0 && index < _count);
+	return *Advance(_data, static_cast<long long>(_stride) * index);
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::GetSubview(int index) const -> StridedView<ItemType>
+{
+	return GetSubview(index, _count - index, 1);
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::GetSubview(int index, int count) const -> StridedView<ItemType>
+{
+	return GetSubview(index, count, 1);
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::GetSubview(int index, int count, int step) const -> StridedView<ItemType>
+{
+	assert(step > 0);
+
+	if (index < 0 || count < 0 || (count > 0 && index + (count - 1) * step >= _count))
+		return {};
+
+	return { Advance(_data, static_cast<long long>(_stride) * index), count, _stride * step };
+}
+
+template<typename ItemType>
+template<typename ActionType>
+void Pargon::StridedView<ItemType>::ForEach(ActionType action) const
+{
+	if (IsContiguous())
+	{
+		for (auto i = 0; i < _count; i++)
+			action(_data[i]);
+	}
+	else
+	{
+		for (auto i = 0; i < _count; i++)
+			action(*Advance(_data, static_cast<long long>(_stride) * i));
+	}
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::ToList() const -> List<ValueType>
+{
+	List<ValueType> items;
+	items.EnsureCapacity(_count);
+
+	ForEach([&items](ItemType& item) { items.Add(item); });
+	return items;
+}
+
+template<typename ItemType>
+auto Pargon::StridedView<ItemType>::Advance(ItemType* item, long long bytes) -> ItemType*
+{
+	using ByteType = std::conditional_t<std::is_const<ItemType>::value, const unsigned char, unsigned char>;
+	return reinterpret_cast<ItemType*>(reinterpret_cast<ByteType*>(item) + bytes);
+}
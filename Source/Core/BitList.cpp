@@ -0,0 +1,380 @@
+#include "Pargon/Containers/BitList.h"
+#include "Core/Processor.h"
+
+#include <bitset>
+#include <cassert>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+using namespace Pargon;
+
+namespace
+{
+	auto WordCount(int count) -> int
+	{
+		return (count + BitList::WordSize - 1) / BitList::WordSize;
+	}
+
+	auto CountBits(uint64_t word) -> int
+	{
+		return static_cast<int>(std::bitset<64>(word).count());
+	}
+
+	auto CountTrailingZeros(uint64_t word) -> int
+	{
+#if defined(_MSC_VER) && defined(PARGON_X64)
+		unsigned long index;
+		_BitScanForward64(&index, word);
+		return static_cast<int>(index);
+#elif defined(_MSC_VER)
+		unsigned long index;
+
+		if (_BitScanForward(&index, static_cast<unsigned long>(word)))
+			return static_cast<int>(index);
+
+		_BitScanForward(&index, static_cast<unsigned long>(word >> 32));
+		return static_cast<int>(index) + 32;
+#else
+		return __builtin_ctzll(word);
+#endif
+	}
+
+	auto SelectInWord(uint64_t word, int rank) -> int
+	{
+		for (auto i = 0; i < rank; i++)
+			word &= word - 1;
+
+		return CountTrailingZeros(word);
+	}
+
+	struct AndOperation
+	{
+		static auto Apply(uint64_t left, uint64_t right) -> uint64_t { return left & right; }
+#if defined(PARGON_X64)
+		static auto Apply(__m128i left, __m128i right) -> __m128i { return _mm_and_si128(left, right); }
+		PARGON_AVX2 static auto Apply(__m256i left, __m256i right) -> __m256i { return _mm256_and_si256(left, right); }
+#endif
+	};
+
+	struct OrOperation
+	{
+		static auto Apply(uint64_t left, uint64_t right) -> uint64_t { return left | right; }
+#if defined(PARGON_X64)
+		static auto Apply(__m128i left, __m128i right) -> __m128i { return _mm_or_si128(left, right); }
+		PARGON_AVX2 static auto Apply(__m256i left, __m256i right) -> __m256i { return _mm256_or_si256(left, right); }
+#endif
+	};
+
+	struct XorOperation
+	{
+		static auto Apply(uint64_t left, uint64_t right) -> uint64_t { return left ^ right; }
+#if defined(PARGON_X64)
+		static auto Apply(__m128i left, __m128i right) -> __m128i { return _mm_xor_si128(left, right); }
+		PARGON_AVX2 static auto Apply(__m256i left, __m256i right) -> __m256i { return _mm256_xor_si256(left, right); }
+#endif
+	};
+
+	struct AndNotOperation
+	{
+		static auto Apply(uint64_t left, uint64_t right) -> uint64_t { return left & ~right; }
+#if defined(PARGON_X64)
+		static auto Apply(__m128i left, __m128i right) -> __m128i { return _mm_andnot_si128(right, left); }
+		PARGON_AVX2 static auto Apply(__m256i left, __m256i right) -> __m256i { return _mm256_andnot_si256(right, left); }
+#endif
+	};
+
+	template<typename OperationType>
+	void ApplyScalar(uint64_t* left, const uint64_t* right, int start, int count)
+	{
+		for (auto i = start; i < count; i++)
+			left[i] = OperationType::Apply(left[i], right[i]);
+	}
+
+#if defined(PARGON_X64)
+	template<typename OperationType>
+	void ApplySse2(uint64_t* left, const uint64_t* right, int count)
+	{
+		auto i = 0;
+
+		for (; i + 2 <= count; i += 2)
+		{
+			auto result = OperationType::Apply(_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + i)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(left + i), result);
+		}
+
+		ApplyScalar<OperationType>(left, right, i, count);
+	}
+
+	template<typename OperationType>
+	PARGON_AVX2 void ApplyAvx2(uint64_t* left, const uint64_t* right, int count)
+	{
+		auto i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			auto result = OperationType::Apply(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + i)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(left + i), result);
+		}
+
+		ApplyScalar<OperationType>(left, right, i, count);
+	}
+
+	PARGON_AVX2 auto CountBits256(__m256i words) -> __m256i
+	{
+		auto table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		auto nibbles = _mm256_set1_epi8(0x0f);
+
+		auto low = _mm256_shuffle_epi8(table, _mm256_and_si256(words, nibbles));
+		auto high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(words, 4), nibbles));
+
+		return _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256());
+	}
+
+	PARGON_AVX2 auto CountOnesAvx2(const uint64_t* words, int count) -> int
+	{
+		auto totals = _mm256_setzero_si256();
+		auto i = 0;
+
+		for (; i + 4 <= count; i += 4)
+			totals = _mm256_add_epi64(totals, CountBits256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i))));
+
+		alignas(32) uint64_t lanes[4];
+		_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), totals);
+
+		auto ones = static_cast<int>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+
+		for (; i < count; i++)
+			ones += CountBits(words[i]);
+
+		return ones;
+	}
+
+	template<typename OperationType>
+	void Apply(uint64_t* left, const uint64_t* right, int count)
+	{
+		if (HasAvx2())
+			ApplyAvx2<OperationType>(left, right, count);
+		else
+			ApplySse2<OperationType>(left, right, count);
+	}
+
+	auto CountOnes(const uint64_t* words, int count) -> int
+	{
+		if (HasAvx2())
+			return CountOnesAvx2(words, count);
+
+		auto ones = 0;
+		for (auto i = 0; i < count; i++)
+			ones += CountBits(words[i]);
+
+		return ones;
+	}
+#else
+	template<typename OperationType>
+	void Apply(uint64_t* left, const uint64_t* right, int count)
+	{
+		ApplyScalar<OperationType>(left, right, 0, count);
+	}
+
+	auto CountOnes(const uint64_t* words, int count) -> int
+	{
+		auto ones = 0;
+		for (auto i = 0; i < count; i++)
+			ones += CountBits(words[i]);
+
+		return ones;
+	}
+#endif
+}
+
+BitList::BitList(int count, bool value) :
+	_words(WordCount(count), value ? ~uint64_t(0) : 0),
+	_count(count)
+{
+	ClearUnusedBits();
+}
+
+auto BitList::IsEmpty() const -> bool
+{
+	return _count == 0;
+}
+
+auto BitList::Count() const -> int
+{
+	return _count;
+}
+
+auto BitList::LastIndex() const -> int
+{
+	return _count - 1;
+}
+
+auto BitList::Item(int index) const -> bool
+{
+	assert(index >= 0 && index < _count);
+	return (_words.Item(index / WordSize) >> (index % WordSize)) & 1;
+}
+
+void BitList::SetItem(int index, bool value)
+{
+	assert(index >= 0 && index < _count);
+
+	auto& word = _words.Item(index / WordSize);
+	auto mask = uint64_t(1) << (index % WordSize);
+
+	word = (word & ~mask) | (value ? mask : 0);
+}
+
+void BitList::FlipItem(int index)
+{
+	assert(index >= 0 && index < _count);
+	_words.Item(index / WordSize) ^= uint64_t(1) << (index % WordSize);
+}
+
+auto BitList::Words() const -> SequenceView<uint64_t>
+{
+	return _words.GetView();
+}
+
+void BitList::SetCount(int count)
+{
+	auto previous = _count;
+
+	_count = count;
+	_words.SetCount(WordCount(count));
+
+	if (count < previous)
+		ClearUnusedBits();
+}
+
+void BitList::SetAll(bool value)
+{
+	for (auto& word : _words)
+		word = value ? ~uint64_t(0) : 0;
+
+	ClearUnusedBits();
+}
+
+void BitList::Add(bool value)
+{
+	if (_count % WordSize == 0)
+		_words.Add(0);
+
+	_count++;
+
+	if (value)
+		SetItem(_count - 1, true);
+}
+
+void BitList::Clear()
+{
+	_words.Clear();
+	_count = 0;
+}
+
+void BitList::And(const BitList& other)
+{
+	assert(other._count == _count);
+	Apply<AndOperation>(_words.begin(), other._words.begin(), _words.Count());
+}
+
+void BitList::Or(const BitList& other)
+{
+	assert(other._count == _count);
+	Apply<OrOperation>(_words.begin(), other._words.begin(), _words.Count());
+}
+
+void BitList::Xor(const BitList& other)
+{
+	assert(other._count == _count);
+	Apply<XorOperation>(_words.begin(), other._words.begin(), _words.Count());
+}
+
+void BitList::AndNot(const BitList& other)
+{
+	assert(other._count == _count);
+	Apply<AndNotOperation>(_words.begin(), other._words.begin(), _words.Count());
+}
+
+void BitList::Invert()
+{
+	for (auto& word : _words)
+		word = ~word;
+
+	ClearUnusedBits();
+}
+
+auto BitList::CountOnes() const -> int
+{
+	return ::CountOnes(_words.begin(), _words.Count());
+}
+
+auto BitList::Rank(int index) const -> int
+{
+	assert(index >= 0 && index <= _count);
+
+	auto word = index / WordSize;
+	auto bits = index % WordSize;
+	auto ones = ::CountOnes(_words.begin(), word);
+
+	if (bits > 0)
+		ones += CountBits(_words.Item(word) & ((uint64_t(1) << bits) - 1));
+
+	return ones;
+}
+
+auto BitList::Select(int rank) const -> int
+{
+	if (rank < 0)
+		return Sequence::InvalidIndex;
+
+	for (auto i = 0; i < _words.Count(); i++)
+	{
+		auto ones = CountBits(_words.Item(i));
+
+		if (rank < ones)
+			return i * WordSize + SelectInWord(_words.Item(i), rank);
+
+		rank -= ones;
+	}
+
+	return Sequence::InvalidIndex;
+}
+
+auto BitList::FindNextSet(int start) const -> int
+{
+	if (start < 0 || start >= _count)
+		return Sequence::InvalidIndex;
+
+	auto index = start / WordSize;
+	auto word = _words.Item(index) & (~uint64_t(0) << (start % WordSize));
+
+	while (word == 0)
+	{
+		if (++index == _words.Count())
+			return Sequence::InvalidIndex;
+
+		word = _words.Item(index);
+	}
+
+	return index * WordSize + CountTrailingZeros(word);
+}
+
+void BitList::ForEachSet(FunctionView<void(int)> action) const
+{
+	for (auto i = 0; i < _words.Count(); i++)
+	{
+		for (auto word = _words.Item(i); word != 0; word &= word - 1)
+			action(i * WordSize + CountTrailingZeros(word));
+	}
+}
+
+void BitList::ClearUnusedBits()
+{
+	auto bits = _count % WordSize;
+
+	if (bits > 0)
+		_words.Last() &= (uint64_t(1) << bits) - 1;
+}
@@ -16,13 +16,13 @@ Buffer::Buffer(std::unique_ptr<uint8_t[]>&& bytes, int size) :
 
 Buffer::Buffer(BufferView view)
 {
-	SetSize(view.Size());
+	SetSizeUninitialized(view.Size());
 	std::copy(view.begin(), view.end(), _data.get());
 }
 
 auto Buffer::operator=(BufferView view) -> Buffer&
 {
-	SetSize(view.Size());
+	SetSizeUninitialized(view.Size());
 	std::copy(view.begin(), view.end(), _data.get());
 	return *this;
 }
@@ -47,25 +47,18 @@ void Buffer::SetBytes(int index, BufferView bytes)
 
 void Buffer::SetSize(int size)
 {
-	if (size > _available)
-	{
-		auto newSize = _used + _used / 2;
-		if (size > newSize)
-			newSize = size;
-
-		auto buffer = std::make_unique<uint8_t[]>(newSize);
-		std::copy(_data.get(), _data.get() + _used, buffer.get());
-		_data = std::move(buffer);
-		_available = newSize;
-	}
+	Resize(size, true);
+}
 
-	_used = size;
+void Buffer::SetSizeUninitialized(int size)
+{
+	Resize(size, false);
 }
 
 void Buffer::Append(uint8_t value, int count)
 {
 	auto start = _used;
-	SetSize(_used + count);
+	SetSizeUninitialized(_used + count);
 
 	for (auto i = start; i < _used; i++)
 		_data[i] = value;
@@ -74,7 +67,7 @@ void Buffer::Append(uint8_t value, int count)
 void Buffer::Append(BufferView view, bool reverse)
 {
 	auto start = _used;
-	SetSize(_used + view.Size());
+	SetSizeUninitialized(_used + view.Size());
 
 	if (reverse)
 		std::reverse_copy(view.begin(), view.end(), _data.get() + start);
@@ -89,6 +82,13 @@ auto Buffer::Reserve(int size) -> BufferReference
 	return { _data.get() + start, size };
 }
 
+auto Buffer::ReserveUninitialized(int size) -> BufferReference
+{
+	auto start = _used;
+	SetSizeUninitialized(_used + size);
+	return { _data.get() + start, size };
+}
+
 void Buffer::Erase(uint8_t value)
 {
 	std::fill(_data.get(), _data.get() + _used, value);
@@ -101,6 +101,26 @@ void Buffer::Clear()
 	_data.reset();
 }
 
+void Buffer::Resize(int size, bool initialize)
+{
+	if (size > _available)
+	{
+		auto newSize = _used + _used / 2;
+		if (size > newSize)
+			newSize = size;
+
+		auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[newSize]);
+		std::copy(_data.get(), _data.get() + _used, buffer.get());
+		_data = std::move(buffer);
+		_available = newSize;
+	}
+
+	if (initialize && size > _used)
+		std::fill(_data.get() + _used, _data.get() + size, static_cast<uint8_t>(0));
+
+	_used = size;
+}
+
 auto Buffer::GetView() const -> BufferView
 {
 	return GetView(0, _used);
@@ -0,0 +1,225 @@
+#include "Pargon/Containers/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace Pargon;
+
+namespace
+{
+	struct Batch
+	{
+		FunctionView<void(int)> Task;
+		std::atomic<int> Remaining;
+		std::atomic<bool> Failed = false;
+		std::exception_ptr Exception = nullptr;
+
+		void Execute(int index)
+		{
+			if (!Failed.load(std::memory_order_relaxed))
+			{
+				try
+				{
+					Task(index);
+				}
+				catch (...)
+				{
+					if (!Failed.exchange(true))
+						Exception = std::current_exception();
+				}
+			}
+
+			Remaining.fetch_sub(1, std::memory_order_release);
+		}
+	};
+
+	struct Job
+	{
+		Batch* Owner;
+		int Index;
+	};
+
+	struct Worker
+	{
+		std::mutex Mutex;
+		std::deque<Job> Jobs;
+	};
+
+	thread_local const void* _currentPool = nullptr;
+	thread_local int _currentWorker = -1;
+}
+
+struct ThreadPool::Details
+{
+	std::vector<std::unique_ptr<Worker>> Workers;
+	std::vector<std::thread> Threads;
+
+	std::mutex Mutex;
+	std::condition_variable Condition;
+	std::atomic<int> Pending = 0;
+	std::atomic<unsigned int> Next = 0;
+	bool Stopping = false;
+
+	void Push(int worker, Job job)
+	{
+		auto& queue = *Workers[worker];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+		queue.Jobs.push_back(job);
+	}
+
+	auto Pop(int worker, Job& job) -> bool
+	{
+		auto& queue = *Workers[worker];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+
+		if (queue.Jobs.empty())
+			return false;
+
+		job = queue.Jobs.back();
+		queue.Jobs.pop_back();
+		return true;
+	}
+
+	auto Steal(int worker, Job& job) -> bool
+	{
+		auto& queue = *Workers[worker];
+		std::unique_lock<std::mutex> lock(queue.Mutex, std::try_to_lock);
+
+		if (!lock.owns_lock() || queue.Jobs.empty())
+			return false;
+
+		job = queue.Jobs.front();
+		queue.Jobs.pop_front();
+		return true;
+	}
+
+	auto ExecuteOne(int home) -> bool
+	{
+		Job job;
+		auto found = home >= 0 && Pop(home, job);
+		auto count = static_cast<int>(Workers.size());
+
+		for (auto i = 1; !found && i <= count; i++)
+			found = Steal((home + i + count) % count, job);
+
+		if (!found)
+			return false;
+
+		Pending--;
+		job.Owner->Execute(job.Index);
+		return true;
+	}
+
+	void Work(int index)
+	{
+		_currentPool = this;
+		_currentWorker = index;
+
+		while (true)
+		{
+			if (ExecuteOne(index))
+				continue;
+
+			std::unique_lock<std::mutex> lock(Mutex);
+			Condition.wait(lock, [this] { return Stopping || Pending > 0; });
+
+			if (Stopping)
+				return;
+		}
+	}
+};
+
+auto ThreadPool::Default() -> ThreadPool&
+{
+	static ThreadPool pool(std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 0));
+	return pool;
+}
+
+ThreadPool::ThreadPool(int threadCount) :
+	_details(std::make_unique<Details>())
+{
+	for (auto i = 0; i < threadCount; i++)
+		_details->Workers.push_back(std::make_unique<Worker>());
+
+	for (auto i = 0; i < threadCount; i++)
+		_details->Threads.emplace_back([this, i] { _details->Work(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(_details->Mutex);
+		_details->Stopping = true;
+	}
+
+	_details->Condition.notify_all();
+
+	for (auto& thread : _details->Threads)
+		thread.join();
+}
+
+auto ThreadPool::ThreadCount() const -> int
+{
+	return static_cast<int>(_details->Threads.size()) + 1;
+}
+
+auto ThreadPool::ChunkCount(int itemCount) const -> int
+{
+	auto chunks = itemCount / MinimumChunkSize;
+	auto maximum = ThreadCount() * 4;
+
+	if (chunks > maximum)
+		return maximum;
+
+	return itemCount > 0 && chunks == 0 ? 1 : chunks;
+}
+
+auto ThreadPool::ChunkStart(int itemCount, int chunkCount, int chunk) const -> int
+{
+	return static_cast<int>(static_cast<long long>(itemCount) * chunk / chunkCount);
+}
+
+void ThreadPool::Run(int taskCount, FunctionView<void(int)> task)
+{
+	auto workers = static_cast<int>(_details->Workers.size());
+
+	if (taskCount <= 1 || workers == 0)
+	{
+		for (auto i = 0; i < taskCount; i++)
+			task(i);
+
+		return;
+	}
+
+	Batch batch{ task, taskCount };
+	auto home = _currentPool == _details.get() ? _currentWorker : -1;
+
+	_details->Pending += taskCount;
+
+	for (auto i = 0; i < taskCount; i++)
+	{
+		auto worker = home >= 0 ? home : static_cast<int>(_details->Next++ % workers);
+		_details->Push(worker, { &batch, i });
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_details->Mutex);
+	}
+
+	_details->Condition.notify_all();
+
+	while (batch.Remaining.load(std::memory_order_acquire) > 0)
+	{
+		if (!_details->ExecuteOne(home))
+			std::this_thread::yield();
+	}
+
+	if (batch.Exception)
+		std::rethrow_exception(batch.Exception);
+}
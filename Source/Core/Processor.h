@@ -0,0 +1,46 @@
+#pragma once
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#define PARGON_X64
+	#include <immintrin.h>
+
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define PARGON_AVX2
+	#else
+		#define PARGON_AVX2 __attribute__((target("avx2")))
+	#endif
+
+namespace Pargon
+{
+	inline auto DetectAvx2() -> bool
+	{
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+
+		if (info[0] < 7)
+			return false;
+
+		__cpuid(info, 1);
+
+		auto osxsave = (info[2] & (1 << 27)) != 0;
+		auto avx = (info[2] & (1 << 28)) != 0;
+
+		if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+			return false;
+
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+
+	inline auto HasAvx2() -> bool
+	{
+		static const auto supported = DetectAvx2();
+		return supported;
+	}
+}
+#endif
@@ -0,0 +1,308 @@
+#include "Pargon/Containers/Search.h"
+#include "Core/Processor.h"
+
+#include <bitset>
+#include <cstring>
+
+using namespace Pargon;
+
+namespace
+{
+	template<typename ItemType>
+	auto LoadItem(const ItemType* items, int index) -> ItemType
+	{
+		ItemType item;
+		std::memcpy(&item, items + index, sizeof(ItemType));
+		return item;
+	}
+
+	template<typename ItemType>
+	auto ScalarIndexOf(const ItemType* items, int start, int count, ItemType item) -> int
+	{
+		for (auto i = start; i < count; i++)
+		{
+			if (LoadItem(items, i) == item)
+				return i;
+		}
+
+		return Searching::InvalidIndex;
+	}
+
+	template<typename ItemType>
+	auto ScalarCountOf(const ItemType* items, int start, int count, ItemType item) -> int
+	{
+		auto found = 0;
+
+		for (auto i = start; i < count; i++)
+		{
+			if (LoadItem(items, i) == item)
+				found++;
+		}
+
+		return found;
+	}
+
+	template<typename ItemType>
+	auto ScalarIndicesOf(const ItemType* items, int start, int count, ItemType item, int* indices) -> int
+	{
+		auto found = 0;
+
+		for (auto i = start; i < count; i++)
+		{
+			if (LoadItem(items, i) == item)
+				indices[found++] = i;
+		}
+
+		return found;
+	}
+
+#if defined(PARGON_X64)
+	auto CountTrailingZeros(unsigned int mask) -> int
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<int>(index);
+#else
+		return __builtin_ctz(mask);
+#endif
+	}
+
+	auto CountBits(unsigned int mask) -> int
+	{
+		return static_cast<int>(std::bitset<32>(mask).count());
+	}
+
+	auto Broadcast128(uint8_t item) -> __m128i { return _mm_set1_epi8(static_cast<char>(item)); }
+	auto Broadcast128(uint16_t item) -> __m128i { return _mm_set1_epi16(static_cast<short>(item)); }
+	auto Broadcast128(uint32_t item) -> __m128i { return _mm_set1_epi32(static_cast<int>(item)); }
+	auto Broadcast128(uint64_t item) -> __m128i { return _mm_set1_epi64x(static_cast<long long>(item)); }
+	auto Broadcast128(float item) -> __m128i { return _mm_castps_si128(_mm_set1_ps(item)); }
+	auto Broadcast128(double item) -> __m128i { return _mm_castpd_si128(_mm_set1_pd(item)); }
+
+	auto Equal128(uint8_t, __m128i left, __m128i right) -> __m128i { return _mm_cmpeq_epi8(left, right); }
+	auto Equal128(uint16_t, __m128i left, __m128i right) -> __m128i { return _mm_cmpeq_epi16(left, right); }
+	auto Equal128(uint32_t, __m128i left, __m128i right) -> __m128i { return _mm_cmpeq_epi32(left, right); }
+	auto Equal128(float, __m128i left, __m128i right) -> __m128i { return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(left), _mm_castsi128_ps(right))); }
+	auto Equal128(double, __m128i left, __m128i right) -> __m128i { return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(left), _mm_castsi128_pd(right))); }
+
+	auto Equal128(uint64_t, __m128i left, __m128i right) -> __m128i
+	{
+		auto halves = _mm_cmpeq_epi32(left, right);
+		return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+	}
+
+	PARGON_AVX2 auto Broadcast256(uint8_t item) -> __m256i { return _mm256_set1_epi8(static_cast<char>(item)); }
+	PARGON_AVX2 auto Broadcast256(uint16_t item) -> __m256i { return _mm256_set1_epi16(static_cast<short>(item)); }
+	PARGON_AVX2 auto Broadcast256(uint32_t item) -> __m256i { return _mm256_set1_epi32(static_cast<int>(item)); }
+	PARGON_AVX2 auto Broadcast256(uint64_t item) -> __m256i { return _mm256_set1_epi64x(static_cast<long long>(item)); }
+	PARGON_AVX2 auto Broadcast256(float item) -> __m256i { return _mm256_castps_si256(_mm256_set1_ps(item)); }
+	PARGON_AVX2 auto Broadcast256(double item) -> __m256i { return _mm256_castpd_si256(_mm256_set1_pd(item)); }
+
+	PARGON_AVX2 auto Equal256(uint8_t, __m256i left, __m256i right) -> __m256i { return _mm256_cmpeq_epi8(left, right); }
+	PARGON_AVX2 auto Equal256(uint16_t, __m256i left, __m256i right) -> __m256i { return _mm256_cmpeq_epi16(left, right); }
+	PARGON_AVX2 auto Equal256(uint32_t, __m256i left, __m256i right) -> __m256i { return _mm256_cmpeq_epi32(left, right); }
+	PARGON_AVX2 auto Equal256(uint64_t, __m256i left, __m256i right) -> __m256i { return _mm256_cmpeq_epi64(left, right); }
+	PARGON_AVX2 auto Equal256(float, __m256i left, __m256i right) -> __m256i { return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(left), _mm256_castsi256_ps(right), _CMP_EQ_OQ)); }
+	PARGON_AVX2 auto Equal256(double, __m256i left, __m256i right) -> __m256i { return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(left), _mm256_castsi256_pd(right), _CMP_EQ_OQ)); }
+
+	template<typename ItemType>
+	auto Mask128(const ItemType* items, int index, __m128i target) -> unsigned int
+	{
+		auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(items + index));
+		return static_cast<unsigned int>(_mm_movemask_epi8(Equal128(ItemType(), block, target)));
+	}
+
+	template<typename ItemType>
+	PARGON_AVX2 auto Mask256(const ItemType* items, int index, __m256i target) -> unsigned int
+	{
+		auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(items + index));
+		return static_cast<unsigned int>(_mm256_movemask_epi8(Equal256(ItemType(), block, target)));
+	}
+
+	template<typename ItemType>
+	auto AddIndices(unsigned int mask, int start, int* indices) -> int
+	{
+		constexpr auto lane = (1u << sizeof(ItemType)) - 1u;
+		auto found = 0;
+
+		while (mask != 0)
+		{
+			auto bit = CountTrailingZeros(mask);
+			indices[found++] = start + bit / static_cast<int>(sizeof(ItemType));
+			mask &= ~(lane << bit);
+		}
+
+		return found;
+	}
+
+	template<typename ItemType>
+	auto IndexOfSse2(const ItemType* items, int count, ItemType item) -> int
+	{
+		constexpr auto lanes = static_cast<int>(16 / sizeof(ItemType));
+		auto target = Broadcast128(item);
+		auto i = 0;
+
+		for (; i + lanes <= count; i += lanes)
+		{
+			auto mask = Mask128(items, i, target);
+			if (mask != 0)
+				return i + CountTrailingZeros(mask) / static_cast<int>(sizeof(ItemType));
+		}
+
+		return ScalarIndexOf(items, i, count, item);
+	}
+
+	template<typename ItemType>
+	PARGON_AVX2 auto IndexOfAvx2(const ItemType* items, int count, ItemType item) -> int
+	{
+		constexpr auto lanes = static_cast<int>(32 / sizeof(ItemType));
+		auto target = Broadcast256(item);
+		auto i = 0;
+
+		for (; i + 2 * lanes <= count; i += 2 * lanes)
+		{
+			auto first = Mask256(items, i, target);
+			auto second = Mask256(items, i + lanes, target);
+
+			if ((first | second) != 0)
+			{
+				if (first != 0)
+					return i + CountTrailingZeros(first) / static_cast<int>(sizeof(ItemType));
+
+				return i + lanes + CountTrailingZeros(second) / static_cast<int>(sizeof(ItemType));
+			}
+		}
+
+		for (; i + lanes <= count; i += lanes)
+		{
+			auto mask = Mask256(items, i, target);
+			if (mask != 0)
+				return i + CountTrailingZeros(mask) / static_cast<int>(sizeof(ItemType));
+		}
+
+		return ScalarIndexOf(items, i, count, item);
+	}
+
+	template<typename ItemType>
+	auto CountOfSse2(const ItemType* items, int count, ItemType item) -> int
+	{
+		constexpr auto lanes = static_cast<int>(16 / sizeof(ItemType));
+		auto target = Broadcast128(item);
+		auto found = 0;
+		auto i = 0;
+
+		for (; i + lanes <= count; i += lanes)
+			found += CountBits(Mask128(items, i, target)) / static_cast<int>(sizeof(ItemType));
+
+		return found + ScalarCountOf(items, i, count, item);
+	}
+
+	template<typename ItemType>
+	PARGON_AVX2 auto CountOfAvx2(const ItemType* items, int count, ItemType item) -> int
+	{
+		constexpr auto lanes = static_cast<int>(32 / sizeof(ItemType));
+		auto target = Broadcast256(item);
+		auto found = 0;
+		auto i = 0;
+
+		for (; i + lanes <= count; i += lanes)
+			found += CountBits(Mask256(items, i, target)) / static_cast<int>(sizeof(ItemType));
+
+		return found + ScalarCountOf(items, i, count, item);
+	}
+
+	template<typename ItemType>
+	auto IndicesOfSse2(const ItemType* items, int count, ItemType item, int* indices) -> int
+	{
+		constexpr auto lanes = static_cast<int>(16 / sizeof(ItemType));
+		auto target = Broadcast128(item);
+		auto found = 0;
+		auto i = 0;
+
+		for (; i + lanes <= count; i += lanes)
+		{
+			auto mask = Mask128(items, i, target);
+			if (mask != 0)
+				found += AddIndices<ItemType>(mask, i, indices + found);
+		}
+
+		return found + ScalarIndicesOf(items, i, count, item, indices + found);
+	}
+
+	template<typename ItemType>
+	PARGON_AVX2 auto IndicesOfAvx2(const ItemType* items, int count, ItemType item, int* indices) -> int
+	{
+		constexpr auto lanes = static_cast<int>(32 / sizeof(ItemType));
+		auto target = Broadcast256(item);
+		auto found = 0;
+		auto i = 0;
+
+		for (; i + lanes <= count; i += lanes)
+		{
+			auto mask = Mask256(items, i, target);
+			if (mask != 0)
+				found += AddIndices<ItemType>(mask, i, indices + found);
+		}
+
+		return found + ScalarIndicesOf(items, i, count, item, indices + found);
+	}
+
+	template<typename ItemType>
+	auto IndexOf(const ItemType* items, int count, ItemType item) -> int
+	{
+		return HasAvx2() ? IndexOfAvx2(items, count, item) : IndexOfSse2(items, count, item);
+	}
+
+	template<typename ItemType>
+	auto CountOf(const ItemType* items, int count, ItemType item) -> int
+	{
+		return HasAvx2() ? CountOfAvx2(items, count, item) : CountOfSse2(items, count, item);
+	}
+
+	template<typename ItemType>
+	auto IndicesOf(const ItemType* items, int count, ItemType item, int* indices) -> int
+	{
+		return HasAvx2() ? IndicesOfAvx2(items, count, item, indices) : IndicesOfSse2(items, count, item, indices);
+	}
+#else
+	template<typename ItemType>
+	auto IndexOf(const ItemType* items, int count, ItemType item) -> int
+	{
+		return ScalarIndexOf(items, 0, count, item);
+	}
+
+	template<typename ItemType>
+	auto CountOf(const ItemType* items, int count, ItemType item) -> int
+	{
+		return ScalarCountOf(items, 0, count, item);
+	}
+
+	template<typename ItemType>
+	auto IndicesOf(const ItemType* items, int count, ItemType item, int* indices) -> int
+	{
+		return ScalarIndicesOf(items, 0, count, item, indices);
+	}
+#endif
+}
+
+auto Searching::VectorIndexOf(const uint8_t* items, int count, uint8_t item) -> int { return ::IndexOf(items, count, item); }
+auto Searching::VectorIndexOf(const uint16_t* items, int count, uint16_t item) -> int { return ::IndexOf(items, count, item); }
+auto Searching::VectorIndexOf(const uint32_t* items, int count, uint32_t item) -> int { return ::IndexOf(items, count, item); }
+auto Searching::VectorIndexOf(const uint64_t* items, int count, uint64_t item) -> int { return ::IndexOf(items, count, item); }
+auto Searching::VectorIndexOf(const float* items, int count, float item) -> int { return ::IndexOf(items, count, item); }
+auto Searching::VectorIndexOf(const double* items, int count, double item) -> int { return ::IndexOf(items, count, item); }
+
+auto Searching::VectorCountOf(const uint8_t* items, int count, uint8_t item) -> int { return ::CountOf(items, count, item); }
+auto Searching::VectorCountOf(const uint16_t* items, int count, uint16_t item) -> int { return ::CountOf(items, count, item); }
+auto Searching::VectorCountOf(const uint32_t* items, int count, uint32_t item) -> int { return ::CountOf(items, count, item); }
+auto Searching::VectorCountOf(const uint64_t* items, int count, uint64_t item) -> int { return ::CountOf(items, count, item); }
+auto Searching::VectorCountOf(const float* items, int count, float item) -> int { return ::CountOf(items, count, item); }
+auto Searching::VectorCountOf(const double* items, int count, double item) -> int { return ::CountOf(items, count, item); }
+
+auto Searching::VectorIndicesOf(const uint8_t* items, int count, uint8_t item, int* indices) -> int { return ::IndicesOf(items, count, item, indices); }
+auto Searching::VectorIndicesOf(const uint16_t* items, int count, uint16_t item, int* indices) -> int { return ::IndicesOf(items, count, item, indices); }
+auto Searching::VectorIndicesOf(const uint32_t* items, int count, uint32_t item, int* indices) -> int { return ::IndicesOf(items, count, item, indices); }
+auto Searching::VectorIndicesOf(const uint64_t* items, int count, uint64_t item, int* indices) -> int { return ::IndicesOf(items, count, item, indices); }
+auto Searching::VectorIndicesOf(const float* items, int count, float item, int* indices) -> int { return ::IndicesOf(items, count, item, indices); }
+auto Searching::VectorIndicesOf(const double* items, int count, double item, int* indices) -> int { return ::IndicesOf(items, count, item, indices); }